@@ -0,0 +1,60 @@
+#include <time.h>
+
+#include "../s21_matrix.h"
+
+// Замер s21_mult_matrix на квадратных матрицах при разном числе потоков.
+// Аргументы: размеры матриц (по умолчанию 512 1024 2048).
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static double bench(int size, int threads) {
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t C = {0};
+  s21_create_matrix(size, size, &A);
+  s21_create_matrix(size, size, &B);
+  for (int i = 0; i < size; i++)
+    for (int j = 0; j < size; j++) {
+      A.matrix[i][j] = (double)rand() / RAND_MAX;
+      B.matrix[i][j] = (double)rand() / RAND_MAX;
+    }
+  s21_set_num_threads(threads);
+  double start = now();
+  s21_mult_matrix(&A, &B, &C);
+  double seconds = now() - start;
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+  s21_remove_matrix(&C);
+  return seconds;
+}
+
+int main(int argc, char **argv) {
+  int default_sizes[] = {512, 1024, 2048};
+  int count = argc > 1 ? argc - 1 : 3;
+  int max_threads = s21_set_num_threads(0);
+  printf("%6s %8s %10s %10s %8s\n", "size", "threads", "seconds", "GFLOPS",
+         "speedup");
+  // Степени двойки меньше max_threads, последним - само max_threads
+  int thread_counts[32];
+  int runs = 0;
+  for (int threads = 1; threads < max_threads && runs < 31; threads *= 2) {
+    thread_counts[runs++] = threads;
+  }
+  thread_counts[runs++] = max_threads;
+  for (int s = 0; s < count; s++) {
+    int size = argc > 1 ? atoi(argv[s + 1]) : default_sizes[s];
+    double single = 0;
+    for (int r = 0; r < runs; r++) {
+      int threads = thread_counts[r];
+      double seconds = bench(size, threads);
+      if (threads == 1) single = seconds;
+      printf("%6d %8d %10.3f %10.2f %8.2f\n", size, threads, seconds,
+             2.0 * size * size * size / seconds * 1e-9, single / seconds);
+    }
+  }
+  return 0;
+}
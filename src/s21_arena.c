@@ -0,0 +1,184 @@
+#include "s21_internal.h"
+
+// Под AddressSanitizer свободная память арены помечается недоступной, чтобы
+// обращения к освобожденным или сброшенным матрицам ловились так же, как
+// после free()
+#if defined(__SANITIZE_ADDRESS__)
+#define S21_ARENA_ASAN 1
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define S21_ARENA_ASAN 1
+#endif
+#endif
+
+#ifdef S21_ARENA_ASAN
+#include <sanitizer/asan_interface.h>
+#define S21_POISON(addr, size) ASAN_POISON_MEMORY_REGION(addr, size)
+#define S21_UNPOISON(addr, size) ASAN_UNPOISON_MEMORY_REGION(addr, size)
+#else
+#define S21_POISON(addr, size) ((void)(addr), (void)(size))
+#define S21_UNPOISON(addr, size) ((void)(addr), (void)(size))
+#endif
+
+#define S21_ARENA_MIN_CLASS 6          // Самый маленький блок - 64 байта
+#define S21_ARENA_CHUNK (1024 * 1024)  // Размер куска по умолчанию
+
+// Кусок памяти, из которого блоки нарезаются сдвигом указателя
+typedef struct s21_arena_chunk {
+  struct s21_arena_chunk *next;
+  size_t size;  // Полезный размер после заголовка
+} s21_arena_chunk;
+
+// Заголовок блока: класс размера и ссылка в списке свободных блоков
+typedef struct s21_arena_block {
+  struct s21_arena_block *next;
+  size_t size_class;
+} s21_arena_block;
+
+static char *chunk_data(s21_arena_chunk *chunk) {
+  return (char *)chunk + sizeof(s21_arena_chunk);
+}
+
+// Наименьший класс c, для которого 2^c >= size, или -1
+static int size_class(size_t size) {
+  int c = S21_ARENA_MIN_CLASS;
+  while (c < S21_ARENA_CLASSES && c < (int)(sizeof(size_t) * 8 - 1) &&
+         ((size_t)1 << c) < size) {
+    c++;
+  }
+  return c < S21_ARENA_CLASSES && ((size_t)1 << c) >= size ? c : -1;
+}
+
+// Выделение bytes байт сдвигом указателя: в текущем куске, в следующих уже
+// выделенных кусках (после сброса) или в новом куске в конце списка
+static void *bump(s21_arena_t *arena, size_t bytes) {
+  while (arena->current != NULL &&
+         arena->offset + bytes > arena->current->size) {
+    arena->current = arena->current->next;
+    arena->offset = 0;
+  }
+  if (arena->current == NULL) {
+    size_t size = bytes > arena->chunk_size ? bytes : arena->chunk_size;
+    s21_arena_chunk *chunk =
+        (s21_arena_chunk *)malloc(sizeof(s21_arena_chunk) + size);
+    if (chunk != NULL) {
+      chunk->next = NULL;
+      chunk->size = size;
+      S21_POISON(chunk_data(chunk), size);
+      s21_arena_chunk **tail = &arena->chunks;
+      while (*tail != NULL) tail = &(*tail)->next;
+      *tail = chunk;
+      arena->current = chunk;
+      arena->offset = 0;
+    }
+  }
+  void *memory = NULL;
+  if (arena->current != NULL) {
+    memory = chunk_data(arena->current) + arena->offset;
+    arena->offset += bytes;
+  }
+  return memory;
+}
+
+int s21_arena_init(s21_arena_t *arena, size_t chunk_size) {
+  int code = S21_OK;
+  if (arena == NULL) {
+    code = S21_ERROR;
+  } else {
+    memset(arena, 0, sizeof(*arena));
+    arena->chunk_size = chunk_size > 0 ? chunk_size : S21_ARENA_CHUNK;
+  }
+  return code;
+}
+
+void *s21_arena_alloc(s21_arena_t *arena, size_t size) {
+  void *memory = NULL;
+  int c = size <= SIZE_MAX - sizeof(s21_arena_block)
+              ? size_class(size + sizeof(s21_arena_block))
+              : -1;
+  if (arena != NULL && c >= 0) {
+    s21_arena_block *block = (s21_arena_block *)arena->free_lists[c];
+    if (block != NULL) {
+      arena->free_lists[c] = block->next;  // Повторное использование
+    } else {
+      block = (s21_arena_block *)bump(arena, (size_t)1 << c);
+    }
+    if (block != NULL) {
+      S21_UNPOISON(block, (size_t)1 << c);
+      block->next = NULL;
+      block->size_class = (size_t)c;
+      memory = block + 1;
+    }
+  }
+  return memory;
+}
+
+void s21_arena_release(s21_arena_t *arena, void *memory) {
+  if (arena != NULL && memory != NULL) {
+    s21_arena_block *block = (s21_arena_block *)memory - 1;
+    block->next = (s21_arena_block *)arena->free_lists[block->size_class];
+    arena->free_lists[block->size_class] = block;
+    S21_POISON(memory, ((size_t)1 << block->size_class) - sizeof(*block));
+  }
+}
+
+void s21_arena_reset(s21_arena_t *arena) {
+  if (arena != NULL) {
+    for (s21_arena_chunk *chunk = arena->chunks; chunk != NULL;
+         chunk = chunk->next) {
+      S21_POISON(chunk_data(chunk), chunk->size);
+    }
+    memset(arena->free_lists, 0, sizeof(arena->free_lists));
+    arena->current = arena->chunks;
+    arena->offset = 0;
+  }
+}
+
+void s21_arena_destroy(s21_arena_t *arena) {
+  if (arena != NULL) {
+    s21_arena_chunk *chunk = arena->chunks;
+    while (chunk != NULL) {
+      s21_arena_chunk *next = chunk->next;
+      S21_UNPOISON(chunk_data(chunk), chunk->size);
+      free(chunk);
+      chunk = next;
+    }
+    memset(arena, 0, sizeof(*arena));
+  }
+}
+
+int s21_arena_create_matrix(s21_arena_t *arena, int rows, int columns,
+                            matrix_t *result) {
+  int code = S21_OK;
+  size_t size = s21_matrix_block_size(rows, columns);
+  void *block = NULL;
+
+  if (arena == NULL || result == NULL || size == 0) {
+    code = S21_ERROR;
+  } else {
+    block = s21_arena_alloc(arena, size);
+    if (block != NULL) {
+      memset(block, 0, size);
+      s21_matrix_attach(block, rows, columns, S21_OWNER_ARENA, result);
+    } else {
+      code = S21_ERROR;
+    }
+  }
+
+  if (code == S21_ERROR && result != NULL) {
+    result->matrix = NULL;
+    result->rows = 0;
+    result->columns = 0;
+  }
+
+  return code;
+}
+
+void s21_arena_remove_matrix(s21_arena_t *arena, matrix_t *A) {
+  if (A != NULL) {
+    s21_arena_release(arena, A->matrix);
+    A->matrix = NULL;
+    A->rows = 0;
+    A->columns = 0;
+  }
+}
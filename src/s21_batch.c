@@ -0,0 +1,196 @@
+#include <string.h>
+
+#include "s21_internal.h"
+
+// Часть параллельной задачи берет столько матриц, чтобы набралось порядка
+// S21_BATCH_GRAIN умножений-сложений: мелкие пакеты идут в одном потоке
+#define S21_BATCH_GRAIN (1 << 16)
+
+typedef struct {
+  matrix_t *a;
+  matrix_t *b;
+  matrix_t *result;
+  double *det;
+  int count;
+  int per_part;     // Матриц в одной части
+  char *ws;         // Рабочая память, ws_size байт на поток
+  size_t ws_size;
+  int code;         // Код первой ошибки среди частей
+} batch_job;
+
+// Запоминает код, только пока ошибок еще не было: первая ошибка не
+// перезаписывается последующими
+static void batch_fail(batch_job *job, int code) {
+  int expected = S21_OK;
+  __atomic_compare_exchange_n(&job->code, &expected, code, 0,
+                              __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+}
+
+static void mult_part(void *arg, int part, int worker) {
+  batch_job *job = (batch_job *)arg;
+  int begin = part * job->per_part;
+  int end = job->count - begin < job->per_part ? job->count
+                                               : begin + job->per_part;
+  (void)worker;
+  for (int i = begin; i < end; i++) {
+    matrix_t *a = &job->a[i];
+    matrix_t *b = &job->b[i];
+    if (s21_dgemm(a->rows, b->columns, a->columns, 1.0, a->matrix[0],
+                  a->columns, 1, b->matrix[0], b->columns, 1, 0.0,
+                  job->result[i].matrix[0], b->columns) != S21_OK) {
+      batch_fail(job, S21_ERROR);
+    }
+  }
+}
+
+static void determinant_part(void *arg, int part, int worker) {
+  batch_job *job = (batch_job *)arg;
+  int begin = part * job->per_part;
+  int end = job->count - begin < job->per_part ? job->count
+                                               : begin + job->per_part;
+  double *ws = (double *)(job->ws + (size_t)worker * job->ws_size);
+  for (int i = begin; i < end; i++) {
+    matrix_t *a = &job->a[i];
+    job->det[i] = s21_determinant_gauss(a->matrix[0], a->rows, a->rows, ws);
+  }
+}
+
+static void inverse_part(void *arg, int part, int worker) {
+  batch_job *job = (batch_job *)arg;
+  int begin = part * job->per_part;
+  int end = job->count - begin < job->per_part ? job->count
+                                               : begin + job->per_part;
+  int *pivots = (int *)(job->ws + (size_t)worker * job->ws_size);
+  for (int i = begin; i < end; i++) {
+    matrix_t *a = &job->a[i];
+    matrix_t *result = &job->result[i];
+    int code = S21_OK;
+    if (a->rows <= S21_SMALL_MAX) {
+      code = s21_small_inverse(a->matrix[0], a->rows, result->matrix[0]);
+    } else {
+      memcpy(result->matrix[0], a->matrix[0],
+             (size_t)a->rows * a->columns * sizeof(double));
+      code = s21_gauss_jordan_inverse(result, pivots);
+    }
+    if (code != S21_OK) batch_fail(job, code);
+  }
+}
+
+// Делит пакет на части по cost операций на матрицу и выполняет fn на пуле.
+// Рабочая память ws_size байт на поток выделяется одним блоком; размер
+// округляется до строки кэша, чтобы потоки не делили строки.
+static int run_batch(batch_job *job, s21_task_fn fn, double cost,
+                     size_t ws_size) {
+  int code = S21_OK;
+  job->per_part = cost >= S21_BATCH_GRAIN ? 1 : (int)(S21_BATCH_GRAIN / cost);
+  int parts = (job->count - 1) / job->per_part + 1;
+  int threads = s21_get_num_threads();
+  if (threads > parts) threads = parts;
+  job->ws_size = (ws_size + S21_ALIGNMENT - 1) & ~(size_t)(S21_ALIGNMENT - 1);
+  job->ws = NULL;
+  job->code = S21_OK;
+  if (job->ws_size > 0) {
+    job->ws = (char *)malloc((size_t)threads * job->ws_size);
+    if (job->ws == NULL) code = S21_ERROR;
+  }
+  if (code == S21_OK) {
+    s21_parallel_for(parts, fn, job, threads);
+    code = job->code;
+  }
+  free(job->ws);
+  return code;
+}
+
+// Все матрицы пакета созданы и имеют размер rows × columns
+static int check_batch(matrix_t *A, int count, int rows, int columns) {
+  int code = S21_OK;
+  for (int i = 0; i < count && code == S21_OK; i++) {
+    code = s21_check_result(&A[i], rows, columns);
+  }
+  return code;
+}
+
+// Ни один результат не совпадает со своим аргументом
+static int check_aliasing(matrix_t *A, matrix_t *result, int count) {
+  int code = S21_OK;
+  for (int i = 0; i < count && code == S21_OK; i++) {
+    if (result[i].matrix == A[i].matrix) code = S21_CALC_ERROR;
+  }
+  return code;
+}
+
+int s21_mult_matrix_batch(matrix_t *A, matrix_t *B, matrix_t *result,
+                          int count) {
+  int code = S21_OK;
+  if (A == NULL || B == NULL || result == NULL || count < 0) {
+    code = S21_ERROR;
+  } else if (count > 0) {
+    if (A[0].matrix == NULL || B[0].matrix == NULL) {
+      code = S21_ERROR;
+    } else if (A[0].columns != B[0].rows) {
+      code = S21_CALC_ERROR;
+    }
+    if (code == S21_OK) code = check_batch(A, count, A[0].rows, A[0].columns);
+    if (code == S21_OK) code = check_batch(B, count, B[0].rows, B[0].columns);
+    if (code == S21_OK) {
+      code = check_batch(result, count, A[0].rows, B[0].columns);
+    }
+    if (code == S21_OK) code = check_aliasing(A, result, count);
+    if (code == S21_OK) code = check_aliasing(B, result, count);
+    if (code == S21_OK) {
+      batch_job job = {.a = A, .b = B, .result = result, .count = count};
+      code = run_batch(&job, mult_part,
+                       (double)A[0].rows * A[0].columns * B[0].columns, 0);
+    }
+  }
+  return code;
+}
+
+int s21_determinant_batch(matrix_t *A, double *result, int count) {
+  int code = S21_OK;
+  if (A == NULL || result == NULL || count < 0) {
+    code = S21_ERROR;
+  } else if (count > 0) {
+    // Те же коды, что у s21_determinant: несозданная матрица - S21_CALC_ERROR
+    if (A[0].matrix == NULL) {
+      code = S21_CALC_ERROR;
+    } else if (A[0].rows < 1 || A[0].rows != A[0].columns) {
+      code = S21_ERROR;
+    } else {
+      code = check_batch(A, count, A[0].rows, A[0].columns);
+      if (code == S21_ERROR) code = S21_CALC_ERROR;
+    }
+    if (code == S21_OK) {
+      int n = A[0].rows;
+      batch_job job = {.a = A, .det = result, .count = count};
+      code = run_batch(&job, determinant_part, (double)n * n * n / 3,
+                       S21_DETERMINANT_WS_SIZE(n));
+    }
+  }
+  return code;
+}
+
+int s21_inverse_batch(matrix_t *A, matrix_t *result, int count) {
+  int code = S21_OK;
+  if (A == NULL || result == NULL || count < 0) {
+    code = S21_ERROR;
+  } else if (count > 0) {
+    if (A[0].matrix == NULL || A[0].rows < 1) {
+      code = S21_ERROR;
+    } else if (A[0].rows != A[0].columns) {
+      code = S21_CALC_ERROR;
+    }
+    if (code == S21_OK) code = check_batch(A, count, A[0].rows, A[0].columns);
+    if (code == S21_OK) {
+      code = check_batch(result, count, A[0].rows, A[0].columns);
+    }
+    if (code == S21_OK) code = check_aliasing(A, result, count);
+    if (code == S21_OK) {
+      int n = A[0].rows;
+      batch_job job = {.a = A, .result = result, .count = count};
+      code = run_batch(&job, inverse_part, (double)n * n * n,
+                       (size_t)n * sizeof(int));
+    }
+  }
+  return code;
+}
@@ -0,0 +1,194 @@
+#include <float.h>
+
+#include "s21_internal.h"
+
+// Ширина панели блочного разложения Холецкого
+#define S21_CHOLESKY_NB 64
+
+static int min_int(int a, int b) { return a < b ? a : b; }
+
+// Разложение диагонального блока [k0, k0 + nb) и панели под ним:
+// L11 × L11^T = A11, затем L21 = A21 × L11^{-T}. Блок уже обновлен вкладом
+// предыдущих панелей. Ведущий элемент не больше tolerance (или NaN) значит,
+// что матрица не положительно определенная.
+static int factor_panel(double *a, ptrdiff_t ld, int n, int k0, int nb,
+                        double tolerance) {
+  int code = S21_OK;
+  for (int j = k0; j < k0 + nb && code == S21_OK; j++) {
+    double *row_j = a + j * ld;
+    double diagonal = row_j[j];
+    for (int p = k0; p < j; p++) diagonal -= row_j[p] * row_j[p];
+    if (!(diagonal > tolerance)) {
+      code = S21_CALC_ERROR;
+    } else {
+      row_j[j] = sqrt(diagonal);
+      for (int i = j + 1; i < n; i++) {
+        double *row_i = a + i * ld;
+        double sum = row_i[j];
+        for (int p = k0; p < j; p++) sum -= row_i[p] * row_j[p];
+        row_i[j] = sum / row_j[j];
+      }
+    }
+  }
+  return code;
+}
+
+// A22 -= L21 × L21^T только для нижнего треугольника: по блокам строк,
+// каждый блок обновляется до своего диагонального блока включительно
+static int update_trailing(double *a, ptrdiff_t ld, int n, int k0, int nb) {
+  int code = S21_OK;
+  int start = k0 + nb;
+  for (int i0 = start; i0 < n && code == S21_OK; i0 += S21_CHOLESKY_NB) {
+    int rows = min_int(S21_CHOLESKY_NB, n - i0);
+    // L21^T читается из тех же строк через обмен шагов
+    code = s21_dgemm(rows, i0 + rows - start, nb, -1.0, a + i0 * ld + k0, ld,
+                     1, a + start * ld + k0, 1, ld, 1.0, a + i0 * ld + start,
+                     ld);
+  }
+  return code;
+}
+
+// Блочное разложение "на месте": используется и перезаписывается только
+// нижний треугольник a
+static int cholesky_decompose(double *a, ptrdiff_t ld, int n) {
+  int code = S21_OK;
+  double max_diagonal = 0;
+  for (int i = 0; i < n; i++) {
+    if (fabs(a[i * ld + i]) > max_diagonal) max_diagonal = fabs(a[i * ld + i]);
+  }
+  // У положительно определенной матрицы max|A(i,j)| достигается на диагонали
+  double tolerance = n * DBL_EPSILON * max_diagonal;
+  for (int k0 = 0; k0 < n && code == S21_OK; k0 += S21_CHOLESKY_NB) {
+    int nb = min_int(S21_CHOLESKY_NB, n - k0);
+    code = factor_panel(a, ld, n, k0, nb, tolerance);
+    if (code == S21_OK) code = update_trailing(a, ld, n, k0, nb);
+  }
+  return code;
+}
+
+// L × L^T × X = B для всех nrhs столбцов сразу, X на входе содержит B.
+// Как и в s21_lu_substitute, вклад решенных блоков вычитается через
+// s21_dgemm, а треугольная часть решается внутри диагонального блока.
+static int cholesky_substitute(int n, const double *l, ptrdiff_t ld,
+                               double *x, ptrdiff_t ldx, int nrhs) {
+  int code = S21_OK;
+  for (int k0 = 0; k0 < n && code == S21_OK; k0 += S21_CHOLESKY_NB) {
+    int nb = min_int(S21_CHOLESKY_NB, n - k0);
+    if (k0 > 0) {
+      code = s21_dgemm(nb, nrhs, k0, -1.0, l + k0 * ld, ld, 1, x, ldx, 1, 1.0,
+                       x + k0 * ldx, ldx);
+    }
+    for (int i = k0; i < k0 + nb; i++) {
+      double *x_i = x + i * ldx;
+      for (int j = k0; j < i; j++) {
+        double factor = l[i * ld + j];
+        const double *x_j = x + j * ldx;
+        for (int k = 0; k < nrhs; k++) x_i[k] -= factor * x_j[k];
+      }
+      for (int k = 0; k < nrhs; k++) x_i[k] /= l[i * ld + i];
+    }
+  }
+  // Обратный ход по L^T: элемент (i, j) матрицы L^T - это l[j * ld + i]
+  int last = n > 0 ? (n - 1) / S21_CHOLESKY_NB * S21_CHOLESKY_NB : 0;
+  for (int k0 = last; k0 >= 0 && code == S21_OK; k0 -= S21_CHOLESKY_NB) {
+    int nb = min_int(S21_CHOLESKY_NB, n - k0);
+    int done = n - k0 - nb;
+    if (done > 0) {
+      code = s21_dgemm(nb, nrhs, done, -1.0, l + (k0 + nb) * ld + k0, 1, ld,
+                       x + (k0 + nb) * ldx, ldx, 1, 1.0, x + k0 * ldx, ldx);
+    }
+    for (int i = k0 + nb - 1; i >= k0; i--) {
+      double *x_i = x + i * ldx;
+      for (int j = i + 1; j < k0 + nb; j++) {
+        double factor = l[j * ld + i];
+        const double *x_j = x + j * ldx;
+        for (int k = 0; k < nrhs; k++) x_i[k] -= factor * x_j[k];
+      }
+      for (int k = 0; k < nrhs; k++) x_i[k] /= l[i * ld + i];
+    }
+  }
+  return code;
+}
+
+int s21_cholesky(matrix_t *A, matrix_t *L) {
+  int code = S21_OK;
+  if (A == NULL || L == NULL || A->matrix == NULL || A->rows < 1 ||
+      A->columns < 1) {
+    code = S21_ERROR;
+  } else if (A->rows != A->columns) {
+    code = S21_CALC_ERROR;
+  } else {
+    code = s21_create_matrix(A->rows, A->columns, L);
+  }
+  if (code == S21_OK) {
+    int n = A->rows;
+    for (int i = 0; i < n; i++) {
+      memcpy(L->matrix[i], A->matrix[i], (size_t)(i + 1) * sizeof(double));
+    }
+    code = cholesky_decompose(L->matrix[0], n, n);
+    // Над диагональю остались значения диагональных блоков обновления
+    for (int i = 0; i < n && code == S21_OK; i++) {
+      memset(L->matrix[i] + i + 1, 0, (size_t)(n - i - 1) * sizeof(double));
+    }
+    if (code != S21_OK) s21_remove_matrix(L);
+  }
+  return code;
+}
+
+// Множитель Холецкого создан, квадратный и с положительной диагональю
+static int check_factor(matrix_t *L) {
+  int code = S21_OK;
+  if (L == NULL || L->matrix == NULL || L->rows < 1) {
+    code = S21_ERROR;
+  } else if (L->rows != L->columns) {
+    code = S21_CALC_ERROR;
+  }
+  for (int i = 0; code == S21_OK && i < L->rows; i++) {
+    if (!(L->matrix[i][i] > 0)) code = S21_CALC_ERROR;
+  }
+  return code;
+}
+
+int s21_cholesky_solve(matrix_t *L, matrix_t *B, matrix_t *X) {
+  int code = check_factor(L);
+  if (code == S21_OK && (B == NULL || B->matrix == NULL || X == NULL)) {
+    code = S21_ERROR;
+  } else if (code == S21_OK && B->rows != L->rows) {
+    code = S21_CALC_ERROR;
+  }
+  if (code == S21_OK) code = s21_create_matrix(B->rows, B->columns, X);
+  if (code == S21_OK) {
+    memcpy(X->matrix[0], B->matrix[0],
+           (size_t)B->rows * B->columns * sizeof(double));
+    code = cholesky_substitute(L->rows, L->matrix[0], L->columns,
+                               X->matrix[0], X->columns, X->columns);
+    if (code != S21_OK) s21_remove_matrix(X);
+  }
+  return code;
+}
+
+int s21_cholesky_inverse(matrix_t *L, matrix_t *result) {
+  int code = check_factor(L);
+  if (code == S21_OK && result == NULL) code = S21_ERROR;
+  if (code == S21_OK) code = s21_create_matrix(L->rows, L->rows, result);
+  if (code == S21_OK) {
+    int n = L->rows;
+    for (int i = 0; i < n; i++) result->matrix[i][i] = 1;
+    code = cholesky_substitute(n, L->matrix[0], n, result->matrix[0], n, n);
+    if (code != S21_OK) s21_remove_matrix(result);
+  }
+  return code;
+}
+
+int s21_cholesky_logdet(matrix_t *L, double *result) {
+  int code = check_factor(L);
+  if (code == S21_OK && result == NULL) code = S21_ERROR;
+  if (code == S21_OK) {
+    // det(A) = det(L)^2 = (l(0,0) × … × l(n-1,n-1))^2; сумма логарифмов не
+    // переполняется там, где само произведение ушло бы в бесконечность
+    double sum = 0;
+    for (int i = 0; i < L->rows; i++) sum += log(L->matrix[i][i]);
+    *result = 2 * sum;
+  }
+  return code;
+}
@@ -0,0 +1,283 @@
+#include "s21_internal.h"
+
+// Плитка поэлементного вычисления: значения всех уровней дерева для одной
+// плитки остаются в L1
+#define S21_EXPR_TILE 512
+// Плиток в одной части параллельной задачи
+#define S21_EXPR_CHUNK 64
+
+enum { EXPR_LEAF, EXPR_SUM, EXPR_SUB, EXPR_SCALE, EXPR_MULT };
+
+struct s21_expr_node {
+  int kind;
+  int rows;
+  int columns;
+  int code;     // S21_CALC_ERROR, если размеры аргументов не согласованы
+  int scratch;  // Сколько плиток рабочей памяти нужно при слиянии
+  int uses;     // Число узлов, для которых этот узел - аргумент
+  s21_expr_t *a;
+  s21_expr_t *b;
+  double number;
+  const double *data;  // Значения листа или уже посчитанного узла
+  double *owned;       // Временная матрица узла на время s21_expr_eval
+  s21_expr_graph_t *graph;
+  s21_expr_t *next;  // Список узлов графа
+};
+
+void s21_expr_init(s21_expr_graph_t *graph) {
+  if (graph != NULL) graph->nodes = NULL;
+}
+
+void s21_expr_destroy(s21_expr_graph_t *graph) {
+  if (graph != NULL) {
+    while (graph->nodes != NULL) {
+      s21_expr_t *next = graph->nodes->next;
+      free(graph->nodes->owned);
+      free(graph->nodes);
+      graph->nodes = next;
+    }
+  }
+}
+
+static s21_expr_t *new_node(s21_expr_graph_t *graph, int kind, s21_expr_t *a,
+                            s21_expr_t *b) {
+  s21_expr_t *node = NULL;
+  if (graph != NULL) node = (s21_expr_t *)calloc(1, sizeof(s21_expr_t));
+  if (node != NULL) {
+    node->kind = kind;
+    node->a = a;
+    node->b = b;
+    if (a != NULL) a->uses++;
+    if (b != NULL) b->uses++;
+    node->graph = graph;
+    node->next = graph->nodes;
+    graph->nodes = node;
+  }
+  return node;
+}
+
+s21_expr_t *s21_expr_matrix(s21_expr_graph_t *graph, matrix_t *A) {
+  s21_expr_t *node = NULL;
+  if (A != NULL && A->matrix != NULL && A->rows >= 1 && A->columns >= 1) {
+    node = new_node(graph, EXPR_LEAF, NULL, NULL);
+  }
+  if (node != NULL) {
+    node->rows = A->rows;
+    node->columns = A->columns;
+    node->data = A->matrix[0];
+  }
+  return node;
+}
+
+// Первая ошибка среди аргументов переходит в узел
+static int children_code(const s21_expr_t *a, const s21_expr_t *b) {
+  return a->code != S21_OK ? a->code : b != NULL ? b->code : S21_OK;
+}
+
+static s21_expr_t *elementwise(s21_expr_graph_t *graph, int kind,
+                               s21_expr_t *a, s21_expr_t *b) {
+  s21_expr_t *node = NULL;
+  if (a != NULL && b != NULL) node = new_node(graph, kind, a, b);
+  if (node != NULL) {
+    node->rows = a->rows;
+    node->columns = a->columns;
+    node->code = children_code(a, b);
+    if (node->code == S21_OK &&
+        (a->rows != b->rows || a->columns != b->columns)) {
+      node->code = S21_CALC_ERROR;
+    }
+    // Левый аргумент считается прямо в выходную плитку, правый - в
+    // следующую плитку рабочей памяти
+    node->scratch = a->scratch > b->scratch + 1 ? a->scratch : b->scratch + 1;
+  }
+  return node;
+}
+
+s21_expr_t *s21_expr_sum(s21_expr_graph_t *graph, s21_expr_t *A,
+                         s21_expr_t *B) {
+  return elementwise(graph, EXPR_SUM, A, B);
+}
+
+s21_expr_t *s21_expr_sub(s21_expr_graph_t *graph, s21_expr_t *A,
+                         s21_expr_t *B) {
+  return elementwise(graph, EXPR_SUB, A, B);
+}
+
+s21_expr_t *s21_expr_mult_number(s21_expr_graph_t *graph, s21_expr_t *A,
+                                 double number) {
+  s21_expr_t *node = NULL;
+  if (A != NULL) node = new_node(graph, EXPR_SCALE, A, NULL);
+  if (node != NULL) {
+    node->rows = A->rows;
+    node->columns = A->columns;
+    node->code = A->code;
+    node->number = number;
+    node->scratch = A->scratch;
+  }
+  return node;
+}
+
+s21_expr_t *s21_expr_mult_matrix(s21_expr_graph_t *graph, s21_expr_t *A,
+                                 s21_expr_t *B) {
+  s21_expr_t *node = NULL;
+  if (A != NULL && B != NULL) node = new_node(graph, EXPR_MULT, A, B);
+  if (node != NULL) {
+    node->rows = A->rows;
+    node->columns = B->columns;
+    node->code = children_code(A, B);
+    if (node->code == S21_OK && A->columns != B->rows) {
+      node->code = S21_CALC_ERROR;
+    }
+  }
+  return node;
+}
+
+// Значения узла на участке [offset, offset + len) плоского массива. Узлы с
+// готовыми данными отдают указатель без копирования, поэлементные считаются
+// в out; scratch - рабочие плитки для правых аргументов.
+static const double *eval_tile(const s21_expr_t *e, size_t offset, size_t len,
+                               double *out, double *scratch) {
+  const double *values = out;
+  if (e->data != NULL) {
+    values = e->data + offset;
+  } else if (e->kind == EXPR_SCALE) {
+    s21_vec_scale(eval_tile(e->a, offset, len, out, scratch), e->number, out,
+                  len);
+  } else {
+    const double *left = eval_tile(e->a, offset, len, out, scratch);
+    const double *right =
+        eval_tile(e->b, offset, len, scratch, scratch + S21_EXPR_TILE);
+    if (e->kind == EXPR_SUM) {
+      s21_vec_add(left, right, out, len);
+    } else {
+      s21_vec_sub(left, right, out, len);
+    }
+  }
+  return values;
+}
+
+typedef struct {
+  const s21_expr_t *expr;
+  double *out;
+  size_t count;
+  double *scratch;  // По expr->scratch плиток на поток
+} fuse_job;
+
+static void fuse_part(void *arg, int part, int worker) {
+  const fuse_job *job = (const fuse_job *)arg;
+  double *scratch = job->scratch + (size_t)worker * job->expr->scratch *
+                                       S21_EXPR_TILE;
+  size_t begin = (size_t)part * S21_EXPR_CHUNK * S21_EXPR_TILE;
+  size_t end = begin + S21_EXPR_CHUNK * S21_EXPR_TILE;
+  if (end > job->count) end = job->count;
+  for (size_t offset = begin; offset < end; offset += S21_EXPR_TILE) {
+    size_t len = end - offset < S21_EXPR_TILE ? end - offset : S21_EXPR_TILE;
+    double *out = job->out + offset;
+    const double *values = eval_tile(job->expr, offset, len, out, scratch);
+    if (values != out) memcpy(out, values, len * sizeof(double));
+  }
+}
+
+// Слитое вычисление поэлементного поддерева в out за один проход
+static int fuse(const s21_expr_t *e, double *out) {
+  int code = S21_OK;
+  fuse_job job = {e, out, (size_t)e->rows * e->columns, NULL};
+  size_t chunk = S21_EXPR_CHUNK * S21_EXPR_TILE;
+  int parts = (int)((job.count + chunk - 1) / chunk);
+  int threads = s21_get_num_threads();
+  if (threads > parts) threads = parts;
+  if (e->scratch > 0) {
+    job.scratch = (double *)malloc((size_t)threads * e->scratch *
+                                   S21_EXPR_TILE * sizeof(double));
+    if (job.scratch == NULL) code = S21_ERROR;
+  }
+  if (code == S21_OK) s21_parallel_for(parts, fuse_part, &job, threads);
+  free(job.scratch);
+  return code;
+}
+
+// Значения узла целиком: поэлементное поддерево сливается во временную
+// матрицу, которая живет до конца s21_expr_eval
+static int materialize(s21_expr_t *e) {
+  int code = S21_OK;
+  if (e->data == NULL) {
+    e->owned = (double *)malloc((size_t)e->rows * e->columns * sizeof(double));
+    if (e->owned == NULL) code = S21_ERROR;
+  }
+  if (code == S21_OK && e->data == NULL) {
+    code = fuse(e, e->owned);
+    e->data = e->owned;
+  }
+  return code;
+}
+
+// A × B узла-произведения в dest; аргументы считаются целиком
+static int multiply(s21_expr_t *e, double *dest) {
+  int code = materialize(e->a);
+  if (code == S21_OK) code = materialize(e->b);
+  if (code == S21_OK) {
+    int k = e->a->columns;
+    code = s21_dgemm(e->rows, e->columns, k, 1.0, e->a->data, k, 1,
+                     e->b->data, e->columns, 1, 0.0, dest, e->columns);
+  }
+  return code;
+}
+
+// Все произведения поддерева считаются заранее (в порядке зависимостей),
+// после чего для слияния они выглядят как листья. Поэлементный узел с
+// несколькими потребителями тоже считается один раз: иначе общие
+// подвыражения пересчитывались бы для каждого из них.
+static int compute_products(s21_expr_t *e) {
+  int code = S21_OK;
+  if (e->kind != EXPR_LEAF && e->data == NULL) {
+    code = compute_products(e->a);
+    if (code == S21_OK && e->b != NULL) code = compute_products(e->b);
+    if (code == S21_OK && e->kind == EXPR_MULT) {
+      e->owned = (double *)malloc((size_t)e->rows * e->columns *
+                                  sizeof(double));
+      code = e->owned != NULL ? multiply(e, e->owned) : S21_ERROR;
+      e->data = e->owned;
+    } else if (code == S21_OK && e->uses > 1) {
+      code = materialize(e);
+    }
+  }
+  return code;
+}
+
+// Временные значения одного вычисления освобождаются, граф можно считать
+// снова после изменения исходных матриц
+static void release(s21_expr_graph_t *graph) {
+  for (s21_expr_t *node = graph->nodes; node != NULL; node = node->next) {
+    if (node->owned != NULL) {
+      free(node->owned);
+      node->owned = NULL;
+      node->data = NULL;
+    }
+  }
+}
+
+int s21_expr_eval(s21_expr_t *expr, matrix_t *result) {
+  int code = S21_OK;
+  if (expr == NULL || result == NULL) {
+    code = S21_ERROR;
+  } else {
+    code = expr->code;
+  }
+  if (code == S21_OK) {
+    code = s21_create_matrix(expr->rows, expr->columns, result);
+  }
+  if (code == S21_OK && expr->kind == EXPR_MULT) {
+    // Произведение в корне пишется прямо в результат
+    code = compute_products(expr->a);
+    if (code == S21_OK) code = compute_products(expr->b);
+    if (code == S21_OK) code = multiply(expr, result->matrix[0]);
+    release(expr->graph);
+    if (code != S21_OK) s21_remove_matrix(result);
+  } else if (code == S21_OK) {
+    code = compute_products(expr);
+    if (code == S21_OK) code = fuse(expr, result->matrix[0]);
+    release(expr->graph);
+    if (code != S21_OK) s21_remove_matrix(result);
+  }
+  return code;
+}
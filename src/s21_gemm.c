@@ -0,0 +1,9 @@
+#include "s21_internal.h"
+
+// Блочное умножение для double: микроядро 4 × 8
+#define S21_GEMM_T double
+#define S21_GEMM_NR 8
+#define S21_GEMM_FUNC s21_dgemm
+#define S21_GEMM_WS_FUNC s21_dgemm_ws
+#define S21_GEMM_WS_SIZE s21_dgemm_ws_size
+#include "s21_gemm_impl.h"
@@ -0,0 +1,249 @@
+// Шаблон блочного умножения матриц C = alpha × A × B + beta × C. Файл
+// подключается один раз в s21_gemm.c (double) и в s21_sgemm.c (float);
+// перед подключением задаются:
+//   S21_GEMM_T    - тип элементов;
+//   S21_GEMM_NR   - ширина микропанели B (во float в регистр помещается
+//                   вдвое больше элементов, и панель шире);
+//   S21_GEMM_FUNC - имя функции с сигнатурой s21_dgemm;
+//   S21_GEMM_WS_FUNC и S21_GEMM_WS_SIZE - имена варианта с буфером упаковки
+//                   от вызывающего и функции размера этого буфера.
+// Все остальное - статические функции этой единицы трансляции.
+
+#if !defined(S21_GEMM_T) || !defined(S21_GEMM_NR) ||     \
+    !defined(S21_GEMM_FUNC) || !defined(S21_GEMM_WS_FUNC) || \
+    !defined(S21_GEMM_WS_SIZE)
+#error "S21_GEMM_T, S21_GEMM_NR and S21_GEMM_FUNC* must be defined"
+#endif
+
+// Число строк A в регистровом блоке микроядра (MR × NR)
+#define S21_GEMM_MR 4
+// Размеры кэш-блоков: панель B (KC × NC) живет в L3, блок A (MC × KC) - в L2,
+// микропанель B (KC × NR) - в L1
+#define S21_GEMM_MC 128
+#define S21_GEMM_KC 256
+#define S21_GEMM_NC 4096
+// Ниже этого числа умножений упаковка не окупается
+#define S21_GEMM_SMALL (64 * 64 * 64)
+// Ниже этого числа умножений произведение считается в одном потоке
+#define S21_GEMM_PARALLEL (192.0 * 192.0 * 192.0)
+
+typedef S21_GEMM_T gemm_t;
+
+static int min_int(int a, int b) { return a < b ? a : b; }
+
+static int round_up(int value, int step) {
+  return (value + step - 1) / step * step;
+}
+
+// Простое умножение без упаковки для маленьких матриц (порядок i-p-j, чтобы
+// строки B и C читались последовательно)
+static void gemm_small(int m, int n, int k, gemm_t alpha, const gemm_t *a,
+                       ptrdiff_t rsa, ptrdiff_t csa, const gemm_t *b,
+                       ptrdiff_t rsb, ptrdiff_t csb, gemm_t beta, gemm_t *c,
+                       ptrdiff_t ldc) {
+  for (int i = 0; i < m; i++) {
+    gemm_t *c_row = c + i * ldc;
+    for (int j = 0; j < n; j++) {
+      c_row[j] = beta == 0 ? 0 : beta * c_row[j];
+    }
+    for (int p = 0; p < k; p++) {
+      gemm_t a_ip = alpha * a[i * rsa + p * csa];
+      const gemm_t *b_row = b + p * rsb;
+      for (int j = 0; j < n; j++) {
+        c_row[j] += a_ip * b_row[j * csb];
+      }
+    }
+  }
+}
+
+// Упаковка блока A (mc × kc) в микропанели по MR строк: внутри панели
+// элементы идут столбцами, недостающие строки дополняются нулями
+static void pack_a(int mc, int kc, const gemm_t *a, ptrdiff_t rsa,
+                   ptrdiff_t csa, gemm_t *buf) {
+  for (int i = 0; i < mc; i += S21_GEMM_MR) {
+    int mr = min_int(S21_GEMM_MR, mc - i);
+    for (int p = 0; p < kc; p++) {
+      const gemm_t *src = a + i * rsa + p * csa;
+      int r = 0;
+      for (; r < mr; r++) buf[r] = src[r * rsa];
+      for (; r < S21_GEMM_MR; r++) buf[r] = 0;
+      buf += S21_GEMM_MR;
+    }
+  }
+}
+
+// Упаковка панели B (kc × nc) в микропанели по NR столбцов
+static void pack_b(int kc, int nc, const gemm_t *b, ptrdiff_t rsb,
+                   ptrdiff_t csb, gemm_t *buf) {
+  for (int j = 0; j < nc; j += S21_GEMM_NR) {
+    int nr = min_int(S21_GEMM_NR, nc - j);
+    for (int p = 0; p < kc; p++) {
+      const gemm_t *src = b + p * rsb + j * csb;
+      int q = 0;
+      for (; q < nr; q++) buf[q] = src[q * csb];
+      for (; q < S21_GEMM_NR; q++) buf[q] = 0;
+      buf += S21_GEMM_NR;
+    }
+  }
+}
+
+// Микроядро: блок MR × NR накапливается в регистрах по всей глубине kc,
+// затем записывается в C (только mr × nr реально существующих элементов)
+static void micro_kernel(int kc, const gemm_t *a, const gemm_t *b, int mr,
+                         int nr, gemm_t alpha, gemm_t beta, gemm_t *c,
+                         ptrdiff_t ldc) {
+  gemm_t acc[S21_GEMM_MR][S21_GEMM_NR] = {{0}};
+  for (int p = 0; p < kc; p++) {
+    for (int r = 0; r < S21_GEMM_MR; r++) {
+      gemm_t a_rp = a[r];
+      for (int q = 0; q < S21_GEMM_NR; q++) {
+        acc[r][q] += a_rp * b[q];
+      }
+    }
+    a += S21_GEMM_MR;
+    b += S21_GEMM_NR;
+  }
+  for (int r = 0; r < mr; r++) {
+    gemm_t *c_row = c + r * ldc;
+    for (int q = 0; q < nr; q++) {
+      c_row[q] = beta == 0 ? alpha * acc[r][q]
+                           : alpha * acc[r][q] + beta * c_row[q];
+    }
+  }
+}
+
+// Проход по упакованному блоку A и панели B микроядрами
+static void macro_kernel(int mc, int nc, int kc, gemm_t alpha,
+                         const gemm_t *a_buf, const gemm_t *b_buf, gemm_t beta,
+                         gemm_t *c, ptrdiff_t ldc) {
+  for (int j = 0; j < nc; j += S21_GEMM_NR) {
+    int nr = min_int(S21_GEMM_NR, nc - j);
+    for (int i = 0; i < mc; i += S21_GEMM_MR) {
+      int mr = min_int(S21_GEMM_MR, mc - i);
+      micro_kernel(kc, a_buf + (ptrdiff_t)i * kc, b_buf + (ptrdiff_t)j * kc,
+                   mr, nr, alpha, beta, c + i * ldc + j, ldc);
+    }
+  }
+}
+
+// Один шаг (jc, pc) блочного алгоритма: упакованная панель B общая, блоки C
+// размером до MC строк × chunk столбцов раздаются потокам. Каждый элемент C
+// считается ровно одной частью в одном и том же порядке суммирования, поэтому
+// результат не зависит от числа потоков.
+typedef struct {
+  int m;
+  int nc;
+  int kc;
+  gemm_t alpha;
+  gemm_t beta;
+  const gemm_t *a;  // Начало блока A для текущего pc
+  ptrdiff_t rsa;
+  ptrdiff_t csa;
+  const gemm_t *b_buf;  // Упакованная панель B
+  gemm_t *c;            // Начало блока C для текущего jc
+  ptrdiff_t ldc;
+  gemm_t *a_bufs;   // Буферы упаковки A, по одному на поток
+  size_t a_stride;  // Размер одного буфера A
+  int chunks;       // Частей по столбцам на один блок строк
+  int chunk;        // Столбцов в части (кратно NR)
+} gemm_step;
+
+static void gemm_part(void *arg, int part, int worker) {
+  const gemm_step *step = (const gemm_step *)arg;
+  int ic = part / step->chunks * S21_GEMM_MC;
+  int jr = part % step->chunks * step->chunk;
+  int mc = min_int(S21_GEMM_MC, step->m - ic);
+  int nc = min_int(step->chunk, step->nc - jr);
+  gemm_t *a_buf = step->a_bufs + worker * step->a_stride;
+  pack_a(mc, step->kc, step->a + ic * step->rsa, step->rsa, step->csa, a_buf);
+  macro_kernel(mc, nc, step->kc, step->alpha, a_buf,
+               step->b_buf + (ptrdiff_t)jr * step->kc, step->beta,
+               step->c + ic * step->ldc + jr, step->ldc);
+}
+
+// Маленькое произведение считается без упаковки и буфера
+static int is_small(int m, int n, int k) {
+  return (double)m * n * k < S21_GEMM_SMALL || k == 0;
+}
+
+// Число потоков для произведения: не больше threads, один для небольших
+static int gemm_threads(int m, int n, int k, int threads) {
+  return (double)m * n * k < S21_GEMM_PARALLEL || threads < 1 ? 1 : threads;
+}
+
+size_t S21_GEMM_WS_SIZE(int m, int n, int k, int threads) {
+  size_t size = 0;
+  if (!is_small(m, n, k)) {
+    int mc_max = round_up(min_int(m, S21_GEMM_MC), S21_GEMM_MR);
+    int nc_max = round_up(min_int(n, S21_GEMM_NC), S21_GEMM_NR);
+    int kc_max = min_int(k, S21_GEMM_KC);
+    size = ((size_t)gemm_threads(m, n, k, threads) * mc_max + nc_max) *
+           kc_max;
+  }
+  return size;
+}
+
+void S21_GEMM_WS_FUNC(int m, int n, int k, gemm_t alpha, const gemm_t *a,
+                      ptrdiff_t rsa, ptrdiff_t csa, const gemm_t *b,
+                      ptrdiff_t rsb, ptrdiff_t csb, gemm_t beta, gemm_t *c,
+                      ptrdiff_t ldc, int threads, gemm_t *buffer) {
+  if (is_small(m, n, k)) {
+    gemm_small(m, n, k, alpha, a, rsa, csa, b, rsb, csb, beta, c, ldc);
+  } else {
+    threads = gemm_threads(m, n, k, threads);
+    int mc_max = round_up(min_int(m, S21_GEMM_MC), S21_GEMM_MR);
+    int nc_max = round_up(min_int(n, S21_GEMM_NC), S21_GEMM_NR);
+    int kc_max = min_int(k, S21_GEMM_KC);
+    gemm_t *b_buf = buffer;
+    gemm_step step = {0};
+    step.a_stride = (size_t)mc_max * kc_max;
+    step.a_bufs = b_buf + (size_t)nc_max * kc_max;
+    step.b_buf = b_buf;
+    step.alpha = alpha;
+    step.m = m;
+    step.rsa = rsa;
+    step.csa = csa;
+    step.ldc = ldc;
+    int row_blocks = (m + S21_GEMM_MC - 1) / S21_GEMM_MC;
+    for (int jc = 0; jc < n; jc += S21_GEMM_NC) {
+      step.nc = min_int(S21_GEMM_NC, n - jc);
+      step.c = c + jc;
+      // Если блоков строк меньше, чем потоков, столбцы тоже делятся
+      step.chunks = 1;
+      if (row_blocks < 2 * threads) {
+        step.chunks = (2 * threads + row_blocks - 1) / row_blocks;
+      }
+      step.chunk = round_up((step.nc + step.chunks - 1) / step.chunks,
+                            S21_GEMM_NR);
+      step.chunks = (step.nc + step.chunk - 1) / step.chunk;
+      for (int pc = 0; pc < k; pc += S21_GEMM_KC) {
+        step.kc = min_int(S21_GEMM_KC, k - pc);
+        // Первый блок по k применяет beta, остальные накапливают в C
+        step.beta = pc == 0 ? beta : 1;
+        step.a = a + pc * csa;
+        pack_b(step.kc, step.nc, b + pc * rsb + jc * csb, rsb, csb, b_buf);
+        s21_parallel_for(row_blocks * step.chunks, gemm_part, &step, threads);
+      }
+    }
+  }
+}
+
+int S21_GEMM_FUNC(int m, int n, int k, gemm_t alpha, const gemm_t *a,
+                  ptrdiff_t rsa, ptrdiff_t csa, const gemm_t *b,
+                  ptrdiff_t rsb, ptrdiff_t csb, gemm_t beta, gemm_t *c,
+                  ptrdiff_t ldc) {
+  int code = S21_OK;
+  int threads = s21_get_num_threads();
+  size_t size = S21_GEMM_WS_SIZE(m, n, k, threads);
+  gemm_t *buffer = NULL;
+  if (size > 0) {
+    buffer = (gemm_t *)malloc(size * sizeof(gemm_t));
+    if (buffer == NULL) code = S21_ERROR;
+  }
+  if (code == S21_OK) {
+    S21_GEMM_WS_FUNC(m, n, k, alpha, a, rsa, csa, b, rsb, csb, beta, c, ldc,
+                     threads, buffer);
+  }
+  free(buffer);
+  return code;
+}
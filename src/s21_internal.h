@@ -0,0 +1,197 @@
+#ifndef S21_INTERNAL_H
+#define S21_INTERNAL_H
+
+#include <stddef.h>
+
+#include "s21_matrix.h"
+
+// Внутренние функции библиотеки, в публичный интерфейс не входят
+
+// Блок памяти под матрицу с элементами размера element: указатели на строки,
+// затем данные, выровненные на S21_ALIGNMENT. Размер 0 - некорректные
+// размеры или переполнение.
+size_t s21_slab_size(int rows, int columns, size_t element);
+// Начало выровненных данных в блоке матрицы с rows строками
+void *s21_slab_data(void *block, int rows);
+// Размечает блок размера s21_slab_size(rows, columns, element): заполняет
+// указатели на строки и записывает владельца блока owner (S21_OWNER_*).
+// Данные не обнуляются.
+void s21_slab_attach(void *block, int rows, int columns, size_t element,
+                     int owner);
+// Владелец блока матрицы с первой строкой first_row; S21_OWNER_FOREIGN,
+// если строки не лежат в блоке сразу за указателями
+int s21_slab_owner(const void *block, int rows, int columns, size_t element,
+                   const void *first_row);
+
+// Размер блока памяти под матрицу rows × columns (указатели на строки и
+// выровненные данные) или 0 при некорректных размерах/переполнении
+size_t s21_matrix_block_size(int rows, int columns);
+// Начало выровненных данных в блоке матрицы с rows строками
+double *s21_matrix_data(void *block, int rows);
+// s21_slab_attach для double, заполняющий и поля result
+void s21_matrix_attach(void *block, int rows, int columns, int owner,
+                       matrix_t *result);
+
+// Владелец блока матрицы. Хранится в последнем байте блока: выравнивание
+// данных занимает меньше S21_ALIGNMENT байт, так что этот байт всегда лежит
+// за данными.
+#define S21_OWNER_HEAP 0     // malloc/calloc, блок можно менять через realloc
+#define S21_OWNER_ARENA 1    // Блок арены (s21_arena_create_matrix)
+#define S21_OWNER_FOREIGN 2  // Не блок матрицы (например, файл через mmap)
+// Владелец блока матрицы A; S21_OWNER_FOREIGN, если строки не лежат в блоке
+// A->matrix сразу за указателями
+int s21_matrix_owner(const matrix_t *A);
+
+// S21_ERROR, если result не создана, S21_CALC_ERROR, если ее размер не
+// rows × columns (проверка результата для вариантов _into)
+int s21_check_result(matrix_t *result, int rows, int columns);
+
+// Определитель матрицы n × n со строками через ld элементов методом Гаусса
+// над копией в рабочем буфере ws (не меньше n × n элементов); a не изменяется
+double s21_determinant_gauss(const double *a, ptrdiff_t ld, int n,
+                             double *ws);
+// Обращение квадратной матрицы на месте методом Гаусса-Жордана; pivots -
+// рабочий массив из n элементов. S21_CALC_ERROR для вырожденной матрицы.
+int s21_gauss_jordan_inverse(matrix_t *result, int *pivots);
+
+// Явные развернутые формулы для квадратных матриц n <= S21_SMALL_MAX,
+// хранящихся по строкам без промежутков (s21_small.c): определитель,
+// матрица алгебраических дополнений и обратная через присоединенную.
+// s21_small_inverse возвращает S21_CALC_ERROR, если |det| <= n ×
+// DBL_EPSILON × произведение max|a_ij| по строкам.
+#define S21_SMALL_MAX 4
+double s21_small_det(const double *a, int n);
+void s21_small_cofactors(const double *a, int n, double *c);
+int s21_small_inverse(const double *a, int n, double *inv);
+
+/**
+ * Общее умножение C = alpha × op(A) × op(B) + beta × C для плотных блоков.
+ *
+ * op(A) имеет размер m × k, элемент (i, p) лежит по адресу
+ * a[i * rsa + p * csa]; op(B) имеет размер k × n, элемент (p, j) - по адресу
+ * b[p * rsb + j * csb].
+ * Шаги задают и транспонирование: для A^T достаточно поменять rsa и csa.
+ * C хранится по строкам с шагом строки ldc. При beta == 0 C не читается.
+ *
+ * @return S21_OK или S21_ERROR, если не удалось выделить буферы упаковки
+ * */
+int s21_dgemm(int m, int n, int k, double alpha, const double *a,
+              ptrdiff_t rsa, ptrdiff_t csa, const double *b, ptrdiff_t rsb,
+              ptrdiff_t csb, double beta, double *c, ptrdiff_t ldc);
+// s21_dgemm без выделения памяти: буфер упаковки buffer на
+// s21_dgemm_ws_size(m, n, k, threads) элементов дает вызывающий (для
+// маленьких произведений размер 0 и buffer может быть NULL), считается не
+// более чем в threads потоков
+size_t s21_dgemm_ws_size(int m, int n, int k, int threads);
+void s21_dgemm_ws(int m, int n, int k, double alpha, const double *a,
+                  ptrdiff_t rsa, ptrdiff_t csa, const double *b, ptrdiff_t rsb,
+                  ptrdiff_t csb, double beta, double *c, ptrdiff_t ldc,
+                  int threads, double *buffer);
+
+// То же для float (s21_sgemm.c). s21_sgemm накапливает суммы во float;
+// s21_sgemm_wide расширяет куски A и B до double и накапливает в double через
+// s21_dgemm (нужен временный буфер m × n double).
+int s21_sgemm(int m, int n, int k, float alpha, const float *a, ptrdiff_t rsa,
+              ptrdiff_t csa, const float *b, ptrdiff_t rsb, ptrdiff_t csb,
+              float beta, float *c, ptrdiff_t ldc);
+int s21_sgemm_wide(int m, int n, int k, float alpha, const float *a,
+                   ptrdiff_t rsa, ptrdiff_t csa, const float *b,
+                   ptrdiff_t rsb, ptrdiff_t csb, float beta, float *c,
+                   ptrdiff_t ldc);
+size_t s21_sgemm_ws_size(int m, int n, int k, int threads);
+void s21_sgemm_ws(int m, int n, int k, float alpha, const float *a,
+                  ptrdiff_t rsa, ptrdiff_t csa, const float *b, ptrdiff_t rsb,
+                  ptrdiff_t csb, float beta, float *c, ptrdiff_t ldc,
+                  int threads, float *buffer);
+
+// C = A × B по Штрассену-Винограду (s21_strassen.c): A - m × k с шагом строки
+// lda, B - k × n с шагом ldb. Рабочая память всех уровней рекурсии и буфер
+// упаковки s21_dgemm_ws для листьев выделяются одним блоком.
+// @return S21_OK или S21_ERROR без памяти
+int s21_strassen(int m, int n, int k, const double *a, ptrdiff_t lda,
+                 const double *b, ptrdiff_t ldb, double *c, ptrdiff_t ldc);
+// Включен ли S21_MULT_STRASSEN и достаточно ли велико произведение
+int s21_use_strassen(int m, int n, int k);
+
+// Запись и чтение size байт целиком с повтором после частичных операций и
+// EINTR (s21_io.c). @return S21_OK или S21_CALC_ERROR (ошибка или конец файла)
+int s21_write_all(int fd, const void *buffer, size_t size);
+int s21_read_all(int fd, void *buffer, size_t size);
+
+// Файлы матриц в двоичном формате (s21_io.c). s21_file_create создает файл
+// (O_RDWR) и пишет заголовок, данные начинаются с S21_FILE_HEADER_SIZE.
+// s21_file_open открывает файл с флагами flags и проверяет заголовок и
+// размер; смещение данных - в *offset. При ошибке *fd = -1.
+int s21_file_create(const char *path, uint32_t dtype, int rows, int columns,
+                    int *fd);
+int s21_file_open(const char *path, int flags, uint32_t dtype, int *fd,
+                  int *rows, int *columns, size_t *offset);
+
+// LU-разложение "на месте" плотного блока m × n (m <= n) с шагом строки ld:
+// P × A = L × U, перестановка строк - в perm (m элементов). Ведущие элементы
+// не больше max(m, n) × DBL_EPSILON × max|A| заменяются нулем и выставляют
+// singular; само разложение при этом остается точным тождеством.
+typedef struct {
+  int m;
+  int n;
+  double *a;
+  ptrdiff_t ld;
+  int *perm;
+  int sign;
+  int singular;
+} s21_lu_raw;
+
+int s21_lu_decompose(s21_lu_raw *f);
+
+// Решение L × U × X = B для квадратного разложения n × n, где X на входе
+// содержит уже переставленные строки B (nrhs столбцов, шаг строки ldx).
+// Все правые части обрабатываются за один проход по факторам: блоки строк
+// обновляются через s21_dgemm. @return S21_ERROR, если s21_dgemm не смог
+// выделить буферы упаковки.
+int s21_lu_substitute(int n, const double *lu, ptrdiff_t ld, double *x,
+                      ptrdiff_t ldx, int nrhs);
+
+// Выделение произвольного блока из арены и возврат его в список свободных
+// блоков своего класса размера (s21_arena.c). Блок выровнен на 16 байт.
+void *s21_arena_alloc(s21_arena_t *arena, size_t size);
+void s21_arena_release(s21_arena_t *arena, void *memory);
+
+// Часть параллельной задачи: part - номер части, worker - номер потока
+// (0 - вызывающий поток), меньший числа потоков задачи
+typedef void (*s21_task_fn)(void *arg, int part, int worker);
+
+// Выполняет fn(arg, part, worker) для всех part из [0, count) на постоянном
+// пуле не более чем из max_threads потоков (включая вызывающий) и
+// возвращается, когда все части выполнены (s21_thread_pool.c). Вложенные
+// вызовы выполняются последовательно.
+void s21_parallel_for(int count, s21_task_fn fn, void *arg, int max_threads);
+
+// Поэлементные ядра над непрерывными массивами из n элементов. Реализация
+// (скалярная, SSE2, AVX2 или AVX-512) выбирается при старте (s21_simd.c).
+// Выходной массив c может совпадать с любым из входных.
+void s21_vec_add(const double *a, const double *b, double *c, size_t n);
+void s21_vec_sub(const double *a, const double *b, double *c, size_t n);
+void s21_vec_scale(const double *a, double k, double *c, size_t n);
+// @return SUCCESS, если все |a[i] - b[i]| <= eps, иначе FAILURE
+int s21_vec_eq(const double *a, const double *b, size_t n, double eps);
+// То же для float
+void s21_vec_add_f32(const float *a, const float *b, float *c, size_t n);
+void s21_vec_sub_f32(const float *a, const float *b, float *c, size_t n);
+void s21_vec_scale_f32(const float *a, float k, float *c, size_t n);
+int s21_vec_eq_f32(const float *a, const float *b, size_t n, float eps);
+// Транспонирование плотного блока: b[j * ldb + i] = a[i * lda + j] для
+// rows × cols элементов a. Блоки не должны пересекаться.
+void s21_vec_transpose(const double *a, ptrdiff_t lda, double *b,
+                       ptrdiff_t ldb, int rows, int cols);
+void s21_vec_transpose_f32(const float *a, ptrdiff_t lda, float *b,
+                           ptrdiff_t ldb, int rows, int cols);
+
+// Кэш-независимое транспонирование блока rows × cols (s21_transpose.c):
+// рекурсивное деление большей стороны пополам до плиток, помещающихся в L1,
+// и SIMD-ядро s21_vec_transpose (s21_vec_transpose_f32) на листьях
+void s21_transpose_block(const double *a, ptrdiff_t lda, double *b,
+                         ptrdiff_t ldb, int rows, int cols);
+void s21_transpose_block_f32(const float *a, ptrdiff_t lda, float *b,
+                             ptrdiff_t ldb, int rows, int cols);
+
+#endif
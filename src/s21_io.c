@@ -0,0 +1,347 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "s21_internal.h"
+
+#define S21_FILE_MAGIC "S21MATRX"
+#define S21_FILE_VERSION 1
+#define S21_FILE_BYTE_ORDER 0x01020304u
+
+// Заголовок файла матрицы, 64 байта (формат описан в s21_matrix.h)
+typedef struct {
+  char magic[8];
+  uint32_t version;
+  uint32_t dtype;
+  uint32_t byte_order;
+  uint32_t alignment;
+  uint64_t rows;
+  uint64_t columns;
+  uint64_t data_offset;
+  uint8_t reserved[16];
+} file_header;
+
+_Static_assert(sizeof(file_header) == S21_FILE_HEADER_SIZE,
+               "file header must be 64 bytes");
+
+// Отображенный файл: хранится перед массивом указателей на строки матрицы,
+// чтобы s21_unmap_matrix нашел его по A->matrix
+typedef struct {
+  void *address;
+  size_t length;
+} mapping;
+
+static size_t dtype_size(uint32_t dtype) {
+  size_t size = 0;
+  if (dtype == S21_DTYPE_F64) {
+    size = sizeof(double);
+  } else if (dtype == S21_DTYPE_F32) {
+    size = sizeof(float);
+  }
+  return size;
+}
+
+int s21_write_all(int fd, const void *buffer, size_t size) {
+  const char *bytes = (const char *)buffer;
+  int code = S21_OK;
+  while (size > 0 && code == S21_OK) {
+    ssize_t done = write(fd, bytes, size);
+    if (done > 0) {
+      bytes += done;
+      size -= (size_t)done;
+    } else if (done == 0 || errno != EINTR) {
+      code = S21_CALC_ERROR;
+    }
+  }
+  return code;
+}
+
+int s21_read_all(int fd, void *buffer, size_t size) {
+  char *bytes = (char *)buffer;
+  int code = S21_OK;
+  while (size > 0 && code == S21_OK) {
+    ssize_t done = read(fd, bytes, size);
+    if (done > 0) {
+      bytes += done;
+      size -= (size_t)done;
+    } else if (done == 0 || errno != EINTR) {
+      code = S21_CALC_ERROR;
+    }
+  }
+  return code;
+}
+
+int s21_file_create(const char *path, uint32_t dtype, int rows, int columns,
+                    int *fd) {
+  int code = S21_OK;
+  file_header header = {0};
+  memcpy(header.magic, S21_FILE_MAGIC, sizeof(header.magic));
+  header.version = S21_FILE_VERSION;
+  header.dtype = dtype;
+  header.byte_order = S21_FILE_BYTE_ORDER;
+  header.alignment = S21_ALIGNMENT;
+  header.rows = (uint64_t)rows;
+  header.columns = (uint64_t)columns;
+  header.data_offset = S21_FILE_HEADER_SIZE;
+  *fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (*fd < 0) {
+    code = S21_CALC_ERROR;
+  } else {
+    code = s21_write_all(*fd, &header, sizeof(header));
+    if (code != S21_OK) {
+      close(*fd);
+      *fd = -1;
+    }
+  }
+  return code;
+}
+
+static int save_raw(const char *path, const void *data, int rows,
+                    int columns, uint32_t dtype) {
+  int fd = -1;
+  int code = s21_file_create(path, dtype, rows, columns, &fd);
+  if (code == S21_OK) {
+    code = s21_write_all(fd, data,
+                         (size_t)rows * (size_t)columns * dtype_size(dtype));
+    if (close(fd) != 0) code = S21_CALC_ERROR;
+  }
+  return code;
+}
+
+// Проверка заголовка и размера файла. Размер данных в байтах - в *payload.
+static int check_header(const file_header *header, uint32_t dtype,
+                        off_t file_size, size_t *payload) {
+  int code = S21_OK;
+  if (memcmp(header->magic, S21_FILE_MAGIC, sizeof(header->magic)) != 0 ||
+      header->version != S21_FILE_VERSION || header->dtype != dtype ||
+      header->byte_order != S21_FILE_BYTE_ORDER || header->rows < 1 ||
+      header->columns < 1 || header->rows > INT32_MAX ||
+      header->columns > INT32_MAX || header->alignment == 0 ||
+      header->data_offset < sizeof(file_header) ||
+      header->data_offset % header->alignment != 0 ||
+      header->data_offset % dtype_size(dtype) != 0) {
+    code = S21_CALC_ERROR;
+  } else if (header->rows > SIZE_MAX / dtype_size(dtype) / header->columns) {
+    code = S21_CALC_ERROR;
+  } else {
+    *payload = header->rows * header->columns * dtype_size(dtype);
+    if (file_size < 0 || (uint64_t)file_size < header->data_offset ||
+        (uint64_t)file_size - header->data_offset < *payload) {
+      code = S21_CALC_ERROR;
+    }
+  }
+  return code;
+}
+
+// Открывает файл и читает проверенный заголовок; fd остается открытым
+static int open_checked(const char *path, int flags, uint32_t dtype, int *fd,
+                        file_header *header, size_t *payload) {
+  int code = S21_OK;
+  struct stat info;
+  *fd = open(path, flags);
+  if (*fd < 0) {
+    code = S21_CALC_ERROR;
+  } else if (fstat(*fd, &info) != 0) {
+    code = S21_CALC_ERROR;
+  } else {
+    code = s21_read_all(*fd, header, sizeof(*header));
+    if (code == S21_OK) {
+      code = check_header(header, dtype, info.st_size, payload);
+    }
+  }
+  if (code != S21_OK && *fd >= 0) {
+    close(*fd);
+    *fd = -1;
+  }
+  return code;
+}
+
+// Отображает данные файла только для чтения; *rows_out - массив указателей
+// на строки после служебной записи mapping
+static int map_raw(const char *path, uint32_t dtype, void ***rows_out,
+                   int *rows, int *columns) {
+  int code = S21_OK;
+  int fd = -1;
+  file_header header;
+  size_t payload = 0;
+  mapping *map = NULL;
+  code = open_checked(path, O_RDONLY, dtype, &fd, &header, &payload);
+  if (code == S21_OK) {
+    map = (mapping *)malloc(sizeof(mapping) + header.rows * sizeof(void *));
+    if (map == NULL) code = S21_ERROR;
+  }
+  if (code == S21_OK) {
+    map->length = header.data_offset + payload;
+    map->address = mmap(NULL, map->length, PROT_READ, MAP_SHARED, fd, 0);
+    if (map->address == MAP_FAILED) {
+      free(map);
+      code = S21_CALC_ERROR;
+    }
+  }
+  if (fd >= 0) close(fd);  // Отображение остается действительным
+  if (code == S21_OK) {
+    char *data = (char *)map->address + header.data_offset;
+    size_t row_bytes = header.columns * dtype_size(dtype);
+    void **pointers = (void **)(map + 1);
+    for (uint64_t i = 0; i < header.rows; i++) {
+      pointers[i] = data + i * row_bytes;
+    }
+    *rows_out = pointers;
+    *rows = (int)header.rows;
+    *columns = (int)header.columns;
+  }
+  return code;
+}
+
+static void unmap_raw(void **pointers) {
+  if (pointers != NULL) {
+    mapping *map = (mapping *)pointers - 1;
+    munmap(map->address, map->length);
+    free(map);
+  }
+}
+
+int s21_file_open(const char *path, int flags, uint32_t dtype, int *fd,
+                  int *rows, int *columns, size_t *offset) {
+  file_header header;
+  size_t payload = 0;
+  int code = open_checked(path, flags, dtype, fd, &header, &payload);
+  if (code == S21_OK) {
+    *rows = (int)header.rows;
+    *columns = (int)header.columns;
+    *offset = (size_t)header.data_offset;
+  }
+  return code;
+}
+
+// Открывает файл и переходит к началу данных для чтения через read
+static int open_payload(const char *path, uint32_t dtype, int *fd, int *rows,
+                        int *columns) {
+  size_t offset = 0;
+  int code = s21_file_open(path, O_RDONLY, dtype, fd, rows, columns, &offset);
+  if (code == S21_OK && lseek(*fd, (off_t)offset, SEEK_SET) < 0) {
+    close(*fd);
+    code = S21_CALC_ERROR;
+  }
+  return code;
+}
+
+int s21_save_matrix(const char *path, matrix_t *A) {
+  int code = S21_OK;
+  if (path == NULL || A == NULL || A->matrix == NULL || A->rows < 1 ||
+      A->columns < 1) {
+    code = S21_ERROR;
+  } else {
+    code = save_raw(path, A->matrix[0], A->rows, A->columns, S21_DTYPE_F64);
+  }
+  return code;
+}
+
+int s21_map_matrix(const char *path, matrix_t *result) {
+  int code = S21_OK;
+  if (path == NULL || result == NULL) {
+    code = S21_ERROR;
+  } else {
+    void **pointers = NULL;
+    code = map_raw(path, S21_DTYPE_F64, &pointers, &result->rows,
+                   &result->columns);
+    result->matrix = (double **)pointers;
+    if (code != S21_OK) {
+      result->rows = 0;
+      result->columns = 0;
+    }
+  }
+  return code;
+}
+
+void s21_unmap_matrix(matrix_t *A) {
+  if (A != NULL) {
+    unmap_raw((void **)A->matrix);
+    A->matrix = NULL;
+    A->rows = 0;
+    A->columns = 0;
+  }
+}
+
+int s21_load_matrix(const char *path, matrix_t *result) {
+  int code = S21_OK;
+  int fd = -1;
+  int rows = 0;
+  int columns = 0;
+  if (path == NULL || result == NULL) {
+    code = S21_ERROR;
+  } else {
+    code = open_payload(path, S21_DTYPE_F64, &fd, &rows, &columns);
+  }
+  if (code == S21_OK) {
+    code = s21_create_matrix(rows, columns, result);
+    if (code == S21_OK) {
+      code = s21_read_all(fd, result->matrix[0],
+                      (size_t)rows * columns * sizeof(double));
+      if (code != S21_OK) s21_remove_matrix(result);
+    }
+    close(fd);
+  }
+  return code;
+}
+
+int s21_save_matrix_f32(const char *path, matrix_f32_t *A) {
+  int code = S21_OK;
+  if (path == NULL || A == NULL || A->matrix == NULL || A->rows < 1 ||
+      A->columns < 1) {
+    code = S21_ERROR;
+  } else {
+    code = save_raw(path, A->matrix[0], A->rows, A->columns, S21_DTYPE_F32);
+  }
+  return code;
+}
+
+int s21_map_matrix_f32(const char *path, matrix_f32_t *result) {
+  int code = S21_OK;
+  if (path == NULL || result == NULL) {
+    code = S21_ERROR;
+  } else {
+    void **pointers = NULL;
+    code = map_raw(path, S21_DTYPE_F32, &pointers, &result->rows,
+                   &result->columns);
+    result->matrix = (float **)pointers;
+    if (code != S21_OK) {
+      result->rows = 0;
+      result->columns = 0;
+    }
+  }
+  return code;
+}
+
+void s21_unmap_matrix_f32(matrix_f32_t *A) {
+  if (A != NULL) {
+    unmap_raw((void **)A->matrix);
+    A->matrix = NULL;
+    A->rows = 0;
+    A->columns = 0;
+  }
+}
+
+int s21_load_matrix_f32(const char *path, matrix_f32_t *result) {
+  int code = S21_OK;
+  int fd = -1;
+  int rows = 0;
+  int columns = 0;
+  if (path == NULL || result == NULL) {
+    code = S21_ERROR;
+  } else {
+    code = open_payload(path, S21_DTYPE_F32, &fd, &rows, &columns);
+  }
+  if (code == S21_OK) {
+    code = s21_create_matrix_f32(rows, columns, result);
+    if (code == S21_OK) {
+      code = s21_read_all(fd, result->matrix[0],
+                      (size_t)rows * columns * sizeof(float));
+      if (code != S21_OK) s21_remove_matrix_f32(result);
+    }
+    close(fd);
+  }
+  return code;
+}
@@ -0,0 +1,260 @@
+#include <float.h>
+
+#include "s21_internal.h"
+
+// Ширина панели блочного LU: правее панели обновление идет через s21_dgemm
+#define S21_LU_NB 64
+
+static int min_int(int a, int b) { return a < b ? a : b; }
+
+static void swap_rows(double *a, double *b, int columns) {
+  for (int k = 0; k < columns; k++) {
+    double temp = a[k];
+    a[k] = b[k];
+    b[k] = temp;
+  }
+}
+
+// Разложение панели столбцов [k0, k0 + nb) с выбором ведущего элемента по
+// столбцу. Перестановки строк применяются к строкам целиком. Ведущий элемент
+// не больше tolerance считается нулем: столбец под ним обнуляется.
+static void factor_panel(s21_lu_raw *f, int k0, int nb, double tolerance) {
+  double *a = f->a;
+  ptrdiff_t ld = f->ld;
+  for (int j = k0; j < k0 + nb; j++) {
+    int pivot = j;  // Ведущий элемент
+    for (int i = j + 1; i < f->m; i++) {
+      if (fabs(a[i * ld + j]) > fabs(a[pivot * ld + j])) pivot = i;
+    }
+    if (pivot != j) {
+      swap_rows(a + j * ld, a + pivot * ld, f->n);
+      int temp = f->perm[j];
+      f->perm[j] = f->perm[pivot];
+      f->perm[pivot] = temp;
+      f->sign = -f->sign;
+    }
+    double *row_j = a + j * ld;
+    if (fabs(row_j[j]) <= tolerance) {
+      f->singular = 1;
+      for (int i = j; i < f->m; i++) a[i * ld + j] = 0;
+    } else {
+      for (int i = j + 1; i < f->m; i++) {
+        double *row_i = a + i * ld;
+        double factor = row_i[j] /= row_j[j];
+        for (int k = j + 1; k < k0 + nb; k++) row_i[k] -= factor * row_j[k];
+      }
+    }
+  }
+}
+
+// U12 = L11^{-1} × A12 и A22 -= L21 × U12 для панели [k0, k0 + nb)
+static int update_trailing(s21_lu_raw *f, int k0, int nb) {
+  double *a = f->a;
+  ptrdiff_t ld = f->ld;
+  int below = f->m - k0 - nb;
+  int right = f->n - k0 - nb;
+  int code = S21_OK;
+  if (right > 0) {
+    for (int j = k0; j < k0 + nb; j++) {
+      const double *row_j = a + j * ld;
+      for (int i = j + 1; i < k0 + nb; i++) {
+        double *row_i = a + i * ld;
+        double factor = row_i[j];
+        for (int k = k0 + nb; k < f->n; k++) row_i[k] -= factor * row_j[k];
+      }
+    }
+  }
+  if (right > 0 && below > 0) {
+    code = s21_dgemm(below, right, nb, -1.0, a + (k0 + nb) * ld + k0, ld, 1,
+                     a + k0 * ld + k0 + nb, ld, 1, 1.0,
+                     a + (k0 + nb) * ld + k0 + nb, ld);
+  }
+  return code;
+}
+
+int s21_lu_decompose(s21_lu_raw *f) {
+  int code = S21_OK;
+  double max_abs = 0;
+  for (int i = 0; i < f->m; i++) {
+    const double *row = f->a + i * f->ld;
+    for (int k = 0; k < f->n; k++) {
+      if (fabs(row[k]) > max_abs) max_abs = fabs(row[k]);
+    }
+    f->perm[i] = i;
+  }
+  f->sign = 1;
+  f->singular = 0;
+  // Ведущий элемент меньше этого порога считается нулевым
+  double tolerance = (f->m > f->n ? f->m : f->n) * DBL_EPSILON * max_abs;
+  for (int k0 = 0; k0 < f->m && code == S21_OK; k0 += S21_LU_NB) {
+    int nb = min_int(S21_LU_NB, f->m - k0);
+    factor_panel(f, k0, nb, tolerance);
+    code = update_trailing(f, k0, nb);
+  }
+  return code;
+}
+
+// Прямой ход внутри диагонального блока [k0, k0 + nb): единичная L
+static void forward_block(int k0, int nb, const double *lu, ptrdiff_t ld,
+                          double *x, ptrdiff_t ldx, int nrhs) {
+  for (int i = k0 + 1; i < k0 + nb; i++) {
+    double *x_i = x + i * ldx;
+    for (int j = k0; j < i; j++) {
+      double factor = lu[i * ld + j];
+      if (factor != 0) {
+        const double *x_j = x + j * ldx;
+        for (int k = 0; k < nrhs; k++) x_i[k] -= factor * x_j[k];
+      }
+    }
+  }
+}
+
+// Обратный ход внутри диагонального блока [k0, k0 + nb)
+static void backward_block(int k0, int nb, const double *lu, ptrdiff_t ld,
+                           double *x, ptrdiff_t ldx, int nrhs) {
+  for (int i = k0 + nb - 1; i >= k0; i--) {
+    double *x_i = x + i * ldx;
+    for (int j = i + 1; j < k0 + nb; j++) {
+      double factor = lu[i * ld + j];
+      if (factor != 0) {
+        const double *x_j = x + j * ldx;
+        for (int k = 0; k < nrhs; k++) x_i[k] -= factor * x_j[k];
+      }
+    }
+    for (int k = 0; k < nrhs; k++) x_i[k] /= lu[i * ld + i];
+  }
+}
+
+// Подстановки по блокам строк из S21_LU_NB: вклад уже найденных блоков
+// вычитается одним s21_dgemm на блок (X_blk -= L_blk,done × X_done), а
+// треугольная часть решается только внутри диагонального блока. Так почти
+// вся работа идет через упакованное блочное умножение сразу по всем правым
+// частям.
+int s21_lu_substitute(int n, const double *lu, ptrdiff_t ld, double *x,
+                      ptrdiff_t ldx, int nrhs) {
+  int code = S21_OK;
+  for (int k0 = 0; k0 < n && code == S21_OK; k0 += S21_LU_NB) {
+    int nb = min_int(S21_LU_NB, n - k0);
+    if (k0 > 0) {
+      code = s21_dgemm(nb, nrhs, k0, -1.0, lu + k0 * ld, ld, 1, x, ldx, 1,
+                       1.0, x + k0 * ldx, ldx);
+    }
+    forward_block(k0, nb, lu, ld, x, ldx, nrhs);
+  }
+  int last = n > 0 ? (n - 1) / S21_LU_NB * S21_LU_NB : 0;
+  for (int k0 = last; k0 >= 0 && code == S21_OK; k0 -= S21_LU_NB) {
+    int nb = min_int(S21_LU_NB, n - k0);
+    int done = n - k0 - nb;
+    if (done > 0) {
+      code = s21_dgemm(nb, nrhs, done, -1.0, lu + k0 * ld + k0 + nb, ld, 1,
+                       x + (k0 + nb) * ldx, ldx, 1, 1.0, x + k0 * ldx, ldx);
+    }
+    backward_block(k0, nb, lu, ld, x, ldx, nrhs);
+  }
+  return code;
+}
+
+int s21_lu_factor(matrix_t *A, s21_lu_t *lu) {
+  int code = S21_OK;
+  if (A == NULL || lu == NULL || A->matrix == NULL || A->rows < 1 ||
+      A->columns < 1) {
+    code = S21_ERROR;
+  } else if (A->rows != A->columns) {
+    code = S21_CALC_ERROR;
+  } else {
+    int n = A->rows;
+    lu->lu.matrix = NULL;
+    lu->perm = (int *)malloc((size_t)n * sizeof(int));
+    code = lu->perm == NULL ? S21_ERROR : s21_create_matrix(n, n, &lu->lu);
+    if (code == S21_OK) {
+      memcpy(lu->lu.matrix[0], A->matrix[0], (size_t)n * n * sizeof(double));
+      s21_lu_raw f = {n, n, lu->lu.matrix[0], n, lu->perm, 1, 0};
+      code = s21_lu_decompose(&f);
+      lu->sign = f.sign;
+      lu->singular = f.singular;
+    }
+    if (code != S21_OK) s21_lu_remove(lu);
+  }
+  return code;
+}
+
+void s21_lu_remove(s21_lu_t *lu) {
+  if (lu != NULL) {
+    s21_remove_matrix(&lu->lu);
+    free(lu->perm);
+    lu->perm = NULL;
+    lu->sign = 1;
+    lu->singular = 0;
+  }
+}
+
+int s21_lu_det(s21_lu_t *lu, double *result) {
+  int code = S21_OK;
+  if (lu == NULL || result == NULL || lu->lu.matrix == NULL) {
+    code = S21_ERROR;
+  } else {
+    *result = lu->sign;
+    for (int i = 0; i < lu->lu.rows; i++) *result *= lu->lu.matrix[i][i];
+  }
+  return code;
+}
+
+int s21_lu_solve(s21_lu_t *lu, matrix_t *B, matrix_t *X) {
+  int code = S21_OK;
+  if (lu == NULL || B == NULL || X == NULL || lu->lu.matrix == NULL ||
+      B->matrix == NULL) {
+    code = S21_ERROR;
+  } else if (B->rows != lu->lu.rows || lu->singular) {
+    code = S21_CALC_ERROR;
+  } else {
+    code = s21_create_matrix(B->rows, B->columns, X);
+    if (code == S21_OK) {
+      for (int i = 0; i < B->rows; i++) {
+        memcpy(X->matrix[i], B->matrix[lu->perm[i]],
+               (size_t)B->columns * sizeof(double));
+      }
+      code = s21_lu_substitute(lu->lu.rows, lu->lu.matrix[0], lu->lu.rows,
+                               X->matrix[0], X->columns, X->columns);
+      if (code != S21_OK) s21_remove_matrix(X);
+    }
+  }
+  return code;
+}
+
+int s21_lu_inverse(s21_lu_t *lu, matrix_t *result) {
+  int code = S21_OK;
+  if (lu == NULL || result == NULL || lu->lu.matrix == NULL) {
+    code = S21_ERROR;
+  } else if (lu->singular) {
+    code = S21_CALC_ERROR;
+  } else {
+    int n = lu->lu.rows;
+    code = s21_create_matrix(n, n, result);
+    if (code == S21_OK) {
+      // P × E: в i-й строке единица стоит в столбце perm[i]
+      for (int i = 0; i < n; i++) result->matrix[i][lu->perm[i]] = 1;
+      code = s21_lu_substitute(n, lu->lu.matrix[0], n, result->matrix[0], n,
+                               n);
+      if (code != S21_OK) s21_remove_matrix(result);
+    }
+  }
+  return code;
+}
+
+int s21_solve(matrix_t *A, matrix_t *B, matrix_t *X) {
+  int code = S21_OK;
+  s21_lu_t lu = {0};
+  if (A == NULL || B == NULL || X == NULL || A->matrix == NULL ||
+      B->matrix == NULL || B->columns < 1) {
+    code = S21_ERROR;
+  } else if (B->rows != A->rows) {
+    code = S21_CALC_ERROR;
+  } else {
+    code = s21_lu_factor(A, &lu);
+  }
+  if (code == S21_OK) {
+    code = s21_lu_solve(&lu, B, X);
+    s21_lu_remove(&lu);
+  }
+  return code;
+}
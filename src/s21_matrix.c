@@ -1,53 +1,101 @@
-#include "s21_matrix.h"
+#include <float.h>
+
+#include "s21_internal.h"
+
+size_t s21_slab_size(int rows, int columns, size_t element) {
+  size_t size = 0;
+  if (rows >= 1 && columns >= 1 &&
+      (size_t)rows <= (SIZE_MAX - S21_ALIGNMENT) / sizeof(void *) &&
+      (size_t)columns <= SIZE_MAX / element / (size_t)rows) {
+    // Один блок: массив указателей на строки, выравнивание и сами данные
+    size_t header = (size_t)rows * sizeof(void *) + S21_ALIGNMENT;
+    size_t data = (size_t)rows * (size_t)columns * element;
+    if (data <= SIZE_MAX - header) {
+      size = header + data;
+    }
+  }
+  return size;
+}
+
+void *s21_slab_data(void *block, int rows) {
+  uintptr_t begin = (uintptr_t)((char *)block + rows * sizeof(void *));
+  uintptr_t mask = (uintptr_t)(S21_ALIGNMENT - 1);
+  return (void *)((begin + mask) & ~mask);
+}
+
+size_t s21_matrix_block_size(int rows, int columns) {
+  return s21_slab_size(rows, columns, sizeof(double));
+}
+
+double *s21_matrix_data(void *block, int rows) {
+  return (double *)s21_slab_data(block, rows);
+}
+
+void s21_slab_attach(void *block, int rows, int columns, size_t element,
+                     int owner) {
+  char *values = (char *)s21_slab_data(block, rows);
+  void **pointers = (void **)block;
+  for (int i = 0; i < rows; i++) {
+    pointers[i] = values + (size_t)i * columns * element;
+  }
+  ((unsigned char *)block)[s21_slab_size(rows, columns, element) - 1] =
+      (unsigned char)owner;
+}
+
+int s21_slab_owner(const void *block, int rows, int columns, size_t element,
+                   const void *first_row) {
+  int owner = S21_OWNER_FOREIGN;
+  if (first_row == s21_slab_data((void *)block, rows)) {
+    owner = ((const unsigned char *)
+                 block)[s21_slab_size(rows, columns, element) - 1];
+  }
+  return owner;
+}
+
+void s21_matrix_attach(void *block, int rows, int columns, int owner,
+                       matrix_t *result) {
+  s21_slab_attach(block, rows, columns, sizeof(double), owner);
+  result->matrix = (double **)block;
+  result->rows = rows;
+  result->columns = columns;
+}
+
+int s21_matrix_owner(const matrix_t *A) {
+  return s21_slab_owner(A->matrix, A->rows, A->columns, sizeof(double),
+                        A->matrix[0]);
+}
 
 int s21_create_matrix(int rows, int columns, matrix_t *result) {
   int code = S21_OK;
+  size_t size = s21_matrix_block_size(rows, columns);
+  void *block = NULL;
 
-  if (result == NULL || rows < 1 || columns < 1) {
+  if (result == NULL || size == 0) {
     code = S21_ERROR;
   } else {
-    result->rows = rows;
-    result->columns = columns;
-    result->matrix = (double **)calloc(rows, sizeof(double *));
-
-    if (result->matrix != NULL) {
-      for (int i = 0; i < rows; i++) {
-        result->matrix[i] = (double *)calloc(columns, sizeof(double));
-        if (result->matrix[i] == NULL) {
-          for (int j = 0; j < i; j++) {
-            free(result->matrix[j]);
-          }
-          free(result->matrix);
-          result->matrix = NULL;
-          code = S21_ERROR;
-          break;
-        }
-      }
+    block = calloc(1, size);
+    if (block != NULL) {
+      s21_matrix_attach(block, rows, columns, S21_OWNER_HEAP, result);
     } else {
       code = S21_ERROR;
     }
+  }
 
-    if (code == S21_ERROR) {
-      result->rows = 0;
-      result->columns = 0;
-    }
+  if (code == S21_ERROR && result != NULL) {
+    result->matrix = NULL;
+    result->rows = 0;
+    result->columns = 0;
   }
 
   return code;
 }
 
 void s21_remove_matrix(matrix_t *A) {
-  if (A->matrix != NULL) {
-    for (int i = 0; i < A->rows; i++) {
-      free(A->matrix[i]);
-    }
-    free(A->matrix);
+  if (A != NULL) {
+    free(A->matrix);  // Строки лежат в том же блоке
     A->matrix = NULL;
     A->rows = 0;
     A->columns = 0;
-  } else {
-    A->rows = 0;
-    A->columns = 0;
   }
 }
 
@@ -58,14 +106,19 @@ int s21_eq_matrix(matrix_t *A, matrix_t *B) {
   } else if (A->rows != B->rows || A->columns != B->columns) {
     code = FAILURE;
   } else {
-    for (int i = 0; i < A->rows; i++) {
-      for (int j = 0; j < A->columns; j++) {
-        if (fabs(A->matrix[i][j] - B->matrix[i][j]) > EPSILON) {
-          code = FAILURE;
-          break;
-        }
-      }
-    }
+    code = s21_vec_eq(A->matrix[0], B->matrix[0],
+                      (size_t)A->rows * A->columns, EPSILON);
+  }
+  return code;
+}
+
+// Проверка уже созданной матрицы-результата для функций *_into
+int s21_check_result(matrix_t *result, int rows, int columns) {
+  int code = S21_OK;
+  if (result == NULL || result->matrix == NULL) {
+    code = S21_ERROR;
+  } else if (result->rows != rows || result->columns != columns) {
+    code = S21_CALC_ERROR;
   }
   return code;
 }
@@ -80,16 +133,28 @@ int s21_sum_matrix(matrix_t *A, matrix_t *B, matrix_t *result) {
   } else {
     code = s21_create_matrix(A->rows, A->columns, result);
     if (code == S21_OK) {
-      for (int i = 0; i < A->rows; i++) {
-        for (int j = 0; j < A->columns; j++) {
-          result->matrix[i][j] = A->matrix[i][j] + B->matrix[i][j];
-        }
-      }
+      code = s21_sum_matrix_into(A, B, result);
     }
   }
   return code;
 }
 
+int s21_sum_matrix_into(matrix_t *A, matrix_t *B, matrix_t *result) {
+  int code = S21_OK;
+  if (A == NULL || B == NULL || A->matrix == NULL || B->matrix == NULL) {
+    code = S21_ERROR;
+  } else if (A->rows != B->rows || A->columns != B->columns) {
+    code = S21_CALC_ERROR;
+  } else {
+    code = s21_check_result(result, A->rows, A->columns);
+  }
+  if (code == S21_OK) {
+    s21_vec_add(A->matrix[0], B->matrix[0], result->matrix[0],
+                (size_t)A->rows * A->columns);
+  }
+  return code;
+}
+
 int s21_sub_matrix(matrix_t *A, matrix_t *B, matrix_t *result) {
   int code = S21_OK;
   if (result == NULL || A == NULL || B == NULL || A->matrix == NULL ||
@@ -100,16 +165,28 @@ int s21_sub_matrix(matrix_t *A, matrix_t *B, matrix_t *result) {
   } else {
     code = s21_create_matrix(A->rows, A->columns, result);
     if (code == S21_OK) {
-      for (int i = 0; i < A->rows; i++) {
-        for (int j = 0; j < A->columns; j++) {
-          result->matrix[i][j] = A->matrix[i][j] - B->matrix[i][j];
-        }
-      }
+      code = s21_sub_matrix_into(A, B, result);
     }
   }
   return code;
 }
 
+int s21_sub_matrix_into(matrix_t *A, matrix_t *B, matrix_t *result) {
+  int code = S21_OK;
+  if (A == NULL || B == NULL || A->matrix == NULL || B->matrix == NULL) {
+    code = S21_ERROR;
+  } else if (A->rows != B->rows || A->columns != B->columns) {
+    code = S21_CALC_ERROR;
+  } else {
+    code = s21_check_result(result, A->rows, A->columns);
+  }
+  if (code == S21_OK) {
+    s21_vec_sub(A->matrix[0], B->matrix[0], result->matrix[0],
+                (size_t)A->rows * A->columns);
+  }
+  return code;
+}
+
 int s21_mult_number(matrix_t *A, double number, matrix_t *result) {
   int code = S21_OK;
   if (result == NULL || A == NULL || A->matrix == NULL) {
@@ -119,16 +196,28 @@ int s21_mult_number(matrix_t *A, double number, matrix_t *result) {
   } else {
     code = s21_create_matrix(A->rows, A->columns, result);
     if (code == S21_OK) {
-      for (int i = 0; i < A->rows; i++) {
-        for (int j = 0; j < A->columns; j++) {
-          result->matrix[i][j] = A->matrix[i][j] * number;
-        }
-      }
+      code = s21_mult_number_into(A, number, result);
     }
   }
   return code;
 }
 
+int s21_mult_number_into(matrix_t *A, double number, matrix_t *result) {
+  int code = S21_OK;
+  if (A == NULL || A->matrix == NULL) {
+    code = S21_ERROR;
+  } else if (A->rows < 1 || A->columns < 1) {
+    code = S21_CALC_ERROR;
+  } else {
+    code = s21_check_result(result, A->rows, A->columns);
+  }
+  if (code == S21_OK) {
+    s21_vec_scale(A->matrix[0], number, result->matrix[0],
+                  (size_t)A->rows * A->columns);
+  }
+  return code;
+}
+
 int s21_mult_matrix(matrix_t *A, matrix_t *B, matrix_t *result) {
   int code = S21_OK;
   if (result == NULL || A == NULL || B == NULL || A->matrix == NULL ||
@@ -139,18 +228,79 @@ int s21_mult_matrix(matrix_t *A, matrix_t *B, matrix_t *result) {
   } else {
     code = s21_create_matrix(A->rows, B->columns, result);
     if (code == S21_OK) {
-      for (int i = 0; i < A->rows; i++) {
-        for (int j = 0; j < B->columns; j++) {
-          for (int k = 0; k < A->columns; k++) {
-            result->matrix[i][j] += A->matrix[i][k] * B->matrix[k][j];
-          }
-        }
+      code = s21_mult_matrix_into(A, B, result);
+      if (code != S21_OK) {
+        s21_remove_matrix(result);
       }
     }
   }
   return code;
 }
 
+int s21_mult_matrix_into(matrix_t *A, matrix_t *B, matrix_t *result) {
+  int code = S21_OK;
+  if (A == NULL || B == NULL || A->matrix == NULL || B->matrix == NULL) {
+    code = S21_ERROR;
+  } else if (A->columns != B->rows) {
+    code = S21_CALC_ERROR;
+  } else {
+    code = s21_check_result(result, A->rows, B->columns);
+  }
+  if (code == S21_OK &&
+      (result->matrix == A->matrix || result->matrix == B->matrix)) {
+    code = S21_CALC_ERROR;  // Результат не может совпадать с множителем
+  }
+  if (code == S21_OK && s21_use_strassen(A->rows, B->columns, A->columns)) {
+    code = s21_strassen(A->rows, B->columns, A->columns, A->matrix[0],
+                        A->columns, B->matrix[0], B->columns,
+                        result->matrix[0], result->columns);
+  } else if (code == S21_OK) {
+    code = s21_dgemm(A->rows, B->columns, A->columns, 1.0, A->matrix[0],
+                     A->columns, 1, B->matrix[0], B->columns, 1, 0.0,
+                     result->matrix[0], result->columns);
+  }
+  return code;
+}
+
+int s21_gemm(double alpha, matrix_t *A, int transA, matrix_t *B, int transB,
+             double beta, matrix_t *C) {
+  int code = S21_OK;
+  if (A == NULL || B == NULL || A->matrix == NULL || B->matrix == NULL) {
+    code = S21_ERROR;
+  }
+  // Размеры op(A) = m × k и op(B) = k × n
+  int m = 0;
+  int k = 0;
+  int n = 0;
+  if (code == S21_OK) {
+    m = transA ? A->columns : A->rows;
+    k = transA ? A->rows : A->columns;
+    n = transB ? B->rows : B->columns;
+    if ((transB ? B->columns : B->rows) != k) code = S21_CALC_ERROR;
+  }
+  if (code == S21_OK) code = s21_check_result(C, m, n);
+  if (code == S21_OK && (C->matrix == A->matrix || C->matrix == B->matrix)) {
+    code = S21_CALC_ERROR;  // C не может совпадать с множителем
+  }
+  if (code == S21_OK && alpha == 0.0) {
+    // Произведение не нужно: C = beta × C (при beta == 0 C не читается)
+    size_t count = (size_t)m * n;
+    if (beta == 0.0) {
+      memset(C->matrix[0], 0, count * sizeof(double));
+    } else if (beta != 1.0) {
+      s21_vec_scale(C->matrix[0], beta, C->matrix[0], count);
+    }
+  } else if (code == S21_OK) {
+    // Транспонирование - это только обмен шагов строки и столбца
+    ptrdiff_t lda = A->columns;
+    ptrdiff_t ldb = B->columns;
+    code = s21_dgemm(m, n, k, alpha, A->matrix[0], transA ? 1 : lda,
+                     transA ? lda : 1, B->matrix[0], transB ? 1 : ldb,
+                     transB ? ldb : 1, beta, C->matrix[0], C->columns);
+  }
+  return code;
+}
+
 int s21_transpose(matrix_t *A, matrix_t *result) {
   int code = S21_OK;
   if (result == NULL || A == NULL || A->matrix == NULL) {
@@ -160,21 +310,35 @@ int s21_transpose(matrix_t *A, matrix_t *result) {
   } else {
     code = s21_create_matrix(A->columns, A->rows, result);
     if (code == S21_OK) {
-      for (int i = 0; i < A->rows; i++) {
-        for (int j = 0; j < A->columns; j++) {
-          result->matrix[j][i] = A->matrix[i][j];
-        }
-      }
+      code = s21_transpose_into(A, result);
     }
   }
   return code;
 }
 
+int s21_transpose_into(matrix_t *A, matrix_t *result) {
+  int code = S21_OK;
+  if (A == NULL || A->matrix == NULL) {
+    code = S21_ERROR;
+  } else if (A->rows < 1 || A->columns < 1) {
+    code = S21_CALC_ERROR;
+  } else {
+    code = s21_check_result(result, A->columns, A->rows);
+  }
+  if (code == S21_OK && result->matrix == A->matrix) {
+    code = s21_transpose_inplace(A);  // Квадратная матрица сама в себя
+  } else if (code == S21_OK) {
+    s21_transpose_block(A->matrix[0], A->columns, result->matrix[0],
+                        result->columns, A->rows, A->columns);
+  }
+  return code;
+}
+
 int s21_calc_complements(matrix_t *A, matrix_t *result) {
   int code = S21_OK;
   if (result == NULL || A == NULL || A->matrix == NULL) {
     code = S21_ERROR;
-  } else if (A->rows < 1 || A->columns < 1) {
+  } else if (A->rows < 1 || A->columns < 1 || A->rows != A->columns) {
     code = S21_CALC_ERROR;
   } else {
     code = s21_create_matrix(A->rows, A->columns, result);
@@ -188,92 +352,256 @@ int s21_calc_complements(matrix_t *A, matrix_t *result) {
   return code;
 }
 
+// Определитель верхней матрицы Хессенберга m × m, строки которой лежат с
+// шагом ld начиная с h. Исключение идет только между соседними строками,
+// поэтому хватает одной строки рабочей памяти row и O(m^2) операций.
+static double hessenberg_det(const double *h, ptrdiff_t ld, int m,
+                             double *row) {
+  double det = 1;
+  if (m > 0) {
+    memcpy(row, h, (size_t)m * sizeof(double));
+    for (int k = 0; k + 1 < m && det != 0; k++) {
+      const double *next = h + (k + 1) * ld;
+      if (fabs(next[k]) > fabs(row[k])) {
+        // Ведущей становится следующая строка, текущая исключается ею
+        double factor = row[k] / next[k];
+        det *= -next[k];
+        for (int c = k + 1; c < m; c++) row[c] -= factor * next[c];
+      } else if (row[k] != 0) {
+        double factor = next[k] / row[k];
+        det *= row[k];
+        for (int c = k + 1; c < m; c++) row[c] = next[c] - factor * row[c];
+      } else {
+        det = 0;
+      }
+    }
+    det *= row[m - 1];
+  }
+  return det;
+}
+
+// Алгебраические дополнения вырожденной (или почти вырожденной) матрицы.
+// Для каждой вычеркнутой строки i матрица (n-1) × n раскладывается один раз:
+// P × B = L × U. Минор без столбца j равен sign × det(U без столбца j), а
+// U без столбца j - это треугольная часть, за которой идет матрица
+// Хессенберга. Итого O(n^3) на строку и O(n^4) на всю матрицу; ранг
+// учитывается сам: нулевые ведущие элементы дают нулевые миноры.
+static int complements_by_rows(matrix_t *A, matrix_t *result, double *ws,
+                               int *perm) {
+  int code = S21_OK;
+  int n = A->rows;
+  double *row = ws + (size_t)n * n;
+  for (int i = 0; i < n && code == S21_OK; i++) {
+    for (int k = 0, r = 0; k < n; k++) {
+      if (k != i) {
+        memcpy(ws + (size_t)r * n, A->matrix[k], (size_t)n * sizeof(double));
+        r++;
+      }
+    }
+    s21_lu_raw f = {n - 1, n, ws, n, perm, 1, 0};
+    code = s21_lu_decompose(&f);
+    double diagonal = f.sign;  // sign × u(0,0) × … × u(j-1,j-1)
+    for (int j = 0; j < n && code == S21_OK; j++) {
+      double minor = diagonal * hessenberg_det(ws + (size_t)j * n + j + 1, n,
+                                               n - 1 - j, row);
+      result->matrix[i][j] = (i + j) % 2 ? -minor : minor;
+      if (j < n - 1) diagonal *= ws[(size_t)j * n + j];
+    }
+  }
+  return code;
+}
+
+// Алгебраические дополнения через одно LU-разложение: для невырожденной A
+// матрица дополнений равна det(A) × (A^{-1})^T. Вся рабочая память (n × n
+// под факторы, строка для матриц Хессенберга и перестановка) выделяется одним
+// блоком и используется обеими ветками.
 int option_calc_complements(matrix_t *A, matrix_t *result) {
   int code = S21_OK;
-  for (int i = 0; i < A->rows; i++) {
-    for (int j = 0; j < A->columns; j++) {
-      int rows = A->rows <= 1 ? 2 : A->rows;
-      int columns = A->columns <= 1 ? 2 : A->columns;
-      int minor_rows = rows - 1;
-      int minor_columns = columns - 1;
-      matrix_t minor;
-      code = s21_create_matrix(minor_rows, minor_columns, &minor);
-      if (code != S21_OK) {
-        for (int x = 0; x < i; x++) {
-          for (int y = 0; y < A->columns; y++) {
-            s21_remove_matrix(&minor);
+  int n = A->rows;
+  if (n <= S21_SMALL_MAX) {
+    s21_small_cofactors(A->matrix[0], n, result->matrix[0]);
+  } else {
+    size_t doubles = (size_t)n * n + n;
+    double *ws = (double *)malloc(doubles * sizeof(double) + n * sizeof(int));
+    if (ws == NULL) {
+      code = S21_ERROR;
+    } else {
+      int *perm = (int *)(ws + doubles);
+      memcpy(ws, A->matrix[0], (size_t)n * n * sizeof(double));
+      s21_lu_raw f = {n, n, ws, n, perm, 1, 0};
+      code = s21_lu_decompose(&f);
+      if (code == S21_OK && !f.singular) {
+        double det = f.sign;
+        for (int k = 0; k < n; k++) det *= ws[(size_t)k * n + k];
+        // result = A^{-1}: решаем A × X = E
+        memset(result->matrix[0], 0, (size_t)n * n * sizeof(double));
+        for (int k = 0; k < n; k++) result->matrix[k][perm[k]] = 1;
+        code = s21_lu_substitute(n, ws, n, result->matrix[0], n, n);
+        // result = det × result^T
+        for (int k = 0; k < n; k++) {
+          result->matrix[k][k] *= det;
+          for (int l = k + 1; l < n; l++) {
+            double temp = result->matrix[k][l];
+            result->matrix[k][l] = det * result->matrix[l][k];
+            result->matrix[l][k] = det * temp;
           }
         }
-        break;
-      }
-      int remi = 0;
-      int remj = 0;
-      for (int k = 0; k < A->rows; k++) {
-        if (k == i) continue;
-        for (int l = 0; l < A->columns; l++) {
-          if (l == j) continue;
-          minor.matrix[remi][remj] = A->matrix[k][l];
-          remj++;
-        }
-        remi++;
-        remj = 0;
+      } else if (code == S21_OK) {
+        code = complements_by_rows(A, result, ws, perm);
       }
-      double minor_determinant;
-      code = s21_determinant(&minor, &minor_determinant);
-      if (code != S21_OK) {
-        break;
-      }
-      result->matrix[i][j] = pow(-1, i + j) * minor_determinant;
-      s21_remove_matrix(&minor);
+      free(ws);
     }
   }
   return code;
 }
 
-int s21_determinant(matrix_t *A, double *result) {
+static int determinant_check(matrix_t *A, double *result) {
   int code = S21_OK;
-  if (A->rows < 1 || A->columns < 1 || A->rows != A->columns) {
+  if (A == NULL || result == NULL || A->rows < 1 || A->columns < 1 ||
+      A->rows != A->columns) {
     code = S21_ERROR;
   } else if (A->matrix == NULL) {
     code = S21_CALC_ERROR;
   }
-  if (A->columns == 1) {
-    *result = A->matrix[0][0];
-  } else if (A->columns == 2) {
-    *result =
-        A->matrix[0][0] * A->matrix[1][1] - A->matrix[0][1] * A->matrix[1][0];
+  return code;
+}
+
+double s21_determinant_gauss(const double *a, ptrdiff_t ld, int n,
+                             double *ws) {
+  double result = 1;
+  if (ld != n) {
+    // Строки окна собираются в буфер подряд
+    for (int i = 0; i < n; i++) {
+      memcpy(ws + (size_t)i * n, a + i * ld, (size_t)n * sizeof(double));
+    }
+    a = ws;
+  }
+  if (n <= S21_SMALL_MAX) {
+    result = s21_small_det(a, n);
   } else {
-    *result = 1;
-    for (int i = 0; i < A->rows; i++) {
+    size_t stride = (size_t)n;
+    if (a != ws) memcpy(ws, a, stride * stride * sizeof(double));
+    for (int i = 0; i < n; i++) {
+      double *row_i = ws + i * stride;
       int pivotIndex = i;  // Ведущий элемент
 
-      for (int j = i + 1; j < A->rows; j++) {  // Ищем ведущий элементв столбце
-        if (fabs(A->matrix[j][i]) > fabs(A->matrix[pivotIndex][i])) {
+      for (int j = i + 1; j < n; j++) {  // Ищем ведущий элементв столбце
+        if (fabs(ws[j * stride + i]) > fabs(ws[pivotIndex * stride + i])) {
           pivotIndex = j;
         }
       }
 
-      if (A->matrix[pivotIndex][i] == 0) {  // Если ведущий элемент равен нулю,
-                                            // то результат будет равен нулю
-        *result = 0;
+      if (ws[pivotIndex * stride + i] == 0) {  // Если ведущий элемент равен
+                                               // нулю, то результат будет
+                                               // равен нулю
+        result = 0;
         break;
       }
       // Если индекс ведущего элемента не совпадает с индексом ведущей
       // строки, то переставляем строки и меняем знак результата
       if (pivotIndex != i) {
-        double *temp = A->matrix[i];
-        A->matrix[i] = A->matrix[pivotIndex];
-        A->matrix[pivotIndex] = temp;
-        *result *= -1;
+        double *row_p = ws + pivotIndex * stride;
+        for (int k = i; k < n; k++) {
+          double temp = row_i[k];
+          row_i[k] = row_p[k];
+          row_p[k] = temp;
+        }
+        result *= -1;
       }
       // Приведение матрицы к верхнетреугольному виду
-      for (int j = i + 1; j < A->rows; ++j) {
-        double factor = A->matrix[j][i] / A->matrix[i][i];
-        for (int k = i; k < A->columns; ++k) {
-          A->matrix[j][k] -= factor * A->matrix[i][k];
+      for (int j = i + 1; j < n; ++j) {
+        double *row_j = ws + j * stride;
+        double factor = row_j[i] / row_i[i];
+        for (int k = i; k < n; ++k) {
+          row_j[k] -= factor * row_i[k];
+        }
+      }
+      result *= row_i[i];
+    }
+  }
+  return result;
+}
+
+int s21_determinant(matrix_t *A, double *result) {
+  int code = determinant_check(A, result);
+  if (code == S21_OK) {
+    if (A->rows <= S21_DETERMINANT_STACK) {
+      double ws[S21_DETERMINANT_STACK * S21_DETERMINANT_STACK];
+      *result = s21_determinant_gauss(A->matrix[0], A->rows, A->rows, ws);
+    } else {
+      double *ws = (double *)malloc(S21_DETERMINANT_WS_SIZE(A->rows));
+      if (ws == NULL) {
+        code = S21_ERROR;
+      } else {
+        *result =
+            s21_determinant_gauss(A->matrix[0], A->rows, A->rows, ws);
+        free(ws);
+      }
+    }
+  }
+  return code;
+}
+
+int s21_determinant_ws(matrix_t *A, double *result, double *workspace) {
+  int code = determinant_check(A, result);
+  if (code == S21_OK && workspace == NULL) {
+    code = S21_ERROR;
+  }
+  if (code == S21_OK) {
+    *result =
+        s21_determinant_gauss(A->matrix[0], A->rows, A->rows, workspace);
+  }
+  return code;
+}
+
+int s21_gauss_jordan_inverse(matrix_t *result, int *pivots) {
+  int code = S21_OK;
+  int n = result->rows;
+  double **a = result->matrix;
+  double max_abs = 0;
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      if (fabs(a[i][j]) > max_abs) max_abs = fabs(a[i][j]);
+    }
+  }
+  // Ведущий элемент меньше этого порога считается нулевым
+  double tolerance = n * DBL_EPSILON * max_abs;
+  for (int k = 0; k < n && code == S21_OK; k++) {
+    int pivot = k;  // Ведущий элемент
+    for (int i = k + 1; i < n; i++) {
+      if (fabs(a[i][k]) > fabs(a[pivot][k])) pivot = i;
+    }
+    pivots[k] = pivot;
+    if (fabs(a[pivot][k]) <= tolerance) {
+      code = S21_CALC_ERROR;  // Матрица вырождена
+    } else {
+      if (pivot != k) {
+        for (int j = 0; j < n; j++) {
+          double temp = a[k][j];
+          a[k][j] = a[pivot][j];
+          a[pivot][j] = temp;
+        }
+      }
+      double inv_pivot = 1.0 / a[k][k];
+      a[k][k] = 1.0;
+      for (int j = 0; j < n; j++) a[k][j] *= inv_pivot;
+      for (int i = 0; i < n; i++) {
+        double factor = a[i][k];
+        if (i != k && factor != 0) {
+          a[i][k] = 0;
+          for (int j = 0; j < n; j++) a[i][j] -= factor * a[k][j];
         }
       }
-      *result *= A->matrix[i][i];
+    }
+  }
+  // Перестановки строк A превращаются в перестановки столбцов A^{-1}
+  for (int k = n - 1; k >= 0 && code == S21_OK; k--) {
+    if (pivots[k] != k) {
+      for (int i = 0; i < n; i++) {
+        double temp = a[i][k];
+        a[i][k] = a[i][pivots[k]];
+        a[i][pivots[k]] = temp;
+      }
     }
   }
   return code;
@@ -281,38 +609,32 @@ int s21_determinant(matrix_t *A, double *result) {
 
 int s21_inverse_matrix(matrix_t *A, matrix_t *result) {
   int code = S21_OK;
-  if (A->rows != A->columns) {
+  if (A == NULL || result == NULL) {
+    code = S21_ERROR;
+  } else if (A->rows != A->columns) {
     code = S21_CALC_ERROR;
   } else if (A->matrix == NULL || A->rows < 1) {
     code = S21_ERROR;
   } else {
-    double det;
-    matrix_t mat_for_det;
-    s21_create_matrix(A->rows, A->columns, &mat_for_det);
-    for (int x = 0; x < A->rows; x++) {
-      for (int y = 0; y < A->columns; y++) {
-        mat_for_det.matrix[x][y] = A->matrix[x][y];
+    code = s21_create_matrix(A->rows, A->columns, result);
+    if (code == S21_OK && A->rows <= S21_SMALL_MAX) {
+      code = s21_small_inverse(A->matrix[0], A->rows, result->matrix[0]);
+      if (code != S21_OK) {
+        s21_remove_matrix(result);
       }
-    }
-    code = s21_determinant(&mat_for_det, &det);
-
-    if (code == S21_OK && fabs(det) > EPSILON) {
-      matrix_t complements = {0};
-      code = s21_calc_complements(A, &complements);
-      if (code == S21_OK) {
-        matrix_t transposed = {0};
-        code = s21_transpose(&complements, &transposed);
-        s21_remove_matrix(&complements);
-
-        code = s21_create_matrix(A->rows, A->columns, result);
-        if (code == S21_OK) {
-          code = s21_mult_number(&transposed, 1.0 / det, result);
-        }
-
-        s21_remove_matrix(&transposed);
+    } else if (code == S21_OK) {
+      int *pivots = (int *)malloc((size_t)A->rows * sizeof(int));
+      if (pivots == NULL) {
+        code = S21_ERROR;
+      } else {
+        memcpy(result->matrix[0], A->matrix[0],
+               (size_t)A->rows * A->columns * sizeof(double));
+        code = s21_gauss_jordan_inverse(result, pivots);
+        free(pivots);
+      }
+      if (code != S21_OK) {
+        s21_remove_matrix(result);
       }
-    } else {
-      code = S21_CALC_ERROR;  // Если детерминант равен 0 или функция не удалась
     }
   }
   return code;
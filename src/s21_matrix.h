@@ -2,11 +2,18 @@
 #define S21_MATRIX_H
 
 #include <math.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 // Matrix structure
+//
+// Все элементы хранятся одним непрерывным блоком по строкам (row-major),
+// выровненным по S21_ALIGNMENT байт; matrix[i] указывает на начало i-й строки
+// внутри этого блока, а matrix[0] - на начало всех данных. Указатели на строки
+// нельзя переставлять или подменять.
 typedef struct matrix_struct {
   double **matrix;
   int rows;
@@ -22,6 +29,10 @@ typedef struct matrix_struct {
 #define S21_ERROR 1
 #define S21_CALC_ERROR 2
 
+#define S21_ALIGNMENT 64  // Выравнивание данных матрицы (размер кэш-линии)
+
+// @brief Создает матрицу rows × columns, заполненную нулями. Память под
+// указатели на строки и под данные выделяется одним блоком.
 int s21_create_matrix(int rows, int columns, matrix_t *result);
 void s21_remove_matrix(matrix_t *A);
 
@@ -58,14 +69,137 @@ int s21_mult_number(matrix_t *A, double number, matrix_t *result);
 // @brief Произведением матрицы A = m × k на матрицу B = k × n называется
 // матрица C = m × n = A × B размера m × n, элементы которой определяются
 // равенством C(i,j) = A(i,1) × B(1,j) + A(i,2) × B(2,j) + … + A(i,k) × B(k,j).
+//
+// Большие произведения считаются блочно: панели A и B упаковываются под
+// размеры кэшей и обрабатываются регистровым микроядром (s21_gemm.c).
 int s21_mult_matrix(matrix_t *A, matrix_t *B, matrix_t *result);
 
+#define S21_NO_TRANS 0
+#define S21_TRANS 1
+
+/**
+ * Обобщенное умножение на месте: C = alpha × op(A) × op(B) + beta × C, где
+ * op(X) = X при S21_NO_TRANS и X^T при S21_TRANS.
+ *
+ * C должна быть создана заранее размера op(A).rows × op(B).columns и не
+ * может совпадать с A или B (S21_CALC_ERROR). Транспонирование учитывается
+ * при упаковке блоков, копии A^T и B^T не создаются. При beta == 0 исходное
+ * содержимое C не читается.
+ * */
+int s21_gemm(double alpha, matrix_t *A, int transA, matrix_t *B, int transB,
+             double beta, matrix_t *C);
+
 // @brief Транспонирование матрицы А заключается в замене строк этой матрицы ее
 // столбцами с сохранением их номеров.
+//
+// Копирование идет кэш-независимо: большая сторона рекурсивно делится
+// пополам, а плитки транспонируются в SIMD-регистрах (s21_transpose.c).
 int s21_transpose(matrix_t *A, matrix_t *result);
 
+// @brief Транспонирование на месте. Квадратная матрица обменивает плитки
+// над и под диагональю; прямоугольная переставляется по циклам перестановки
+// (дополнительно нужен лишь битовый массив на rows × columns бит), после чего
+// указатели на строки размечаются заново и rows и columns меняются местами.
+//
+// Если столбцов больше, чем строк, массиву указателей нужно больше места и
+// блок увеличивается через realloc; для матрицы арены это невозможно, и
+// возвращается S21_CALC_ERROR. Отображенные на файл матрицы
+// (s21_map_matrix) только для чтения - для них тоже S21_CALC_ERROR.
+int s21_transpose_inplace(matrix_t *A);
+
+/**
+ * Арена для временных матриц.
+ *
+ * Память берется у системы крупными кусками (chunk_size байт) и нарезается
+ * сдвигом указателя. Освобожденные блоки попадают в списки свободных блоков
+ * по классам размера (степени двойки) и переиспользуются для матриц того же
+ * размера. s21_arena_reset разом освобождает все матрицы арены, оставляя
+ * куски памяти для следующего запроса; s21_arena_destroy возвращает их
+ * системе.
+ *
+ * Матрицы арены устроены так же, как созданные s21_create_matrix, и годятся
+ * для любых операций, но удалять их нужно через s21_arena_remove_matrix (или
+ * сбросом арены), а не через s21_remove_matrix. Арена не потокобезопасна.
+ * */
+#define S21_ARENA_CLASSES 48
+
+typedef struct s21_arena_struct {
+  struct s21_arena_chunk *chunks;   // Все куски памяти арены
+  struct s21_arena_chunk *current;  // Кусок, из которого идет выделение
+  size_t offset;                    // Занято байт в current
+  size_t chunk_size;
+  void *free_lists[S21_ARENA_CLASSES];
+} s21_arena_t;
+
+// @brief Инициализирует пустую арену; chunk_size = 0 - размер по умолчанию
+// (1 МиБ). Память выделяется при первом запросе.
+int s21_arena_init(s21_arena_t *arena, size_t chunk_size);
+// @brief Делает недействительными все матрицы арены, сохраняя ее память
+void s21_arena_reset(s21_arena_t *arena);
+// @brief Возвращает всю память арены системе
+void s21_arena_destroy(s21_arena_t *arena);
+// @brief Аналог s21_create_matrix: нулевая матрица из памяти арены
+int s21_arena_create_matrix(s21_arena_t *arena, int rows, int columns,
+                            matrix_t *result);
+// @brief Возвращает блок матрицы в арену для повторного использования
+void s21_arena_remove_matrix(s21_arena_t *arena, matrix_t *A);
+
+// Варианты операций, записывающие результат в уже созданную матрицу нужного
+// размера без выделения памяти. Возвращают S21_ERROR, если result не создана,
+// и S21_CALC_ERROR, если ее размер не подходит.
+//
+// Для суммы, разности и умножения на число result может совпадать с A или B
+// (вычисление на месте), для транспонирования - с квадратной A. Для
+// произведения совпадение с аргументом запрещено (S21_CALC_ERROR).
+int s21_sum_matrix_into(matrix_t *A, matrix_t *B, matrix_t *result);
+int s21_sub_matrix_into(matrix_t *A, matrix_t *B, matrix_t *result);
+int s21_mult_number_into(matrix_t *A, double number, matrix_t *result);
+int s21_mult_matrix_into(matrix_t *A, matrix_t *B, matrix_t *result);
+int s21_transpose_into(matrix_t *A, matrix_t *result);
+
+/**
+ * Представление (view) - прямоугольное окно существующей матрицы без
+ * копирования: data указывает на элемент (0, 0) окна, строки идут с шагом
+ * stride элементов (stride >= columns). Представление не владеет памятью и
+ * действительно, пока жива исходная матрица; запись через data видна в ней.
+ * */
+typedef struct matrix_view_struct {
+  double *data;
+  int rows;
+  int columns;
+  ptrdiff_t stride;
+} matrix_view_t;
+
+// @brief Представление всей матрицы A
+int s21_view_matrix(matrix_t *A, matrix_view_t *result);
+// @brief Окно rows × columns с левым верхним углом (row, column) внутри A.
+// Окно, выходящее за границы A, - S21_CALC_ERROR.
+int s21_view_block(const matrix_view_t *A, int row, int column, int rows,
+                   int columns, matrix_view_t *result);
+// @brief Копирует окно в новую матрицу
+int s21_view_copy(const matrix_view_t *A, matrix_t *result);
+
+// Операции, читающие аргументы через представления. Результат создается и
+// коды ошибок те же, что у одноименных операций над matrix_t; некорректное
+// представление (data == NULL, пустое, stride < columns) - S21_ERROR.
+int s21_eq_view(const matrix_view_t *A, const matrix_view_t *B);
+int s21_sum_view(const matrix_view_t *A, const matrix_view_t *B,
+                 matrix_t *result);
+int s21_sub_view(const matrix_view_t *A, const matrix_view_t *B,
+                 matrix_t *result);
+int s21_mult_number_view(const matrix_view_t *A, double number,
+                         matrix_t *result);
+int s21_mult_view(const matrix_view_t *A, const matrix_view_t *B,
+                  matrix_t *result);
+int s21_transpose_view(const matrix_view_t *A, matrix_t *result);
+int s21_determinant_view(const matrix_view_t *A, double *result);
+
 // @brief Минором M(i,j) называется определитель (n-1)-го порядка, полученный
 // вычёркиванием из матрицы A i-й строки и j-го столбца.
+//
+// Для невырожденной матрицы дополнения считаются как det(A) × (A^{-1})^T по
+// одному LU-разложению за O(n^3); для вырожденной - построчно за O(n^4).
+// Матрицы до 4 × 4 считаются по явным формулам без выделения памяти.
 int s21_calc_complements(matrix_t *A, matrix_t *result);
 
 /** Определитель (детерминант) - это число, которое ставят в соответствие
@@ -78,9 +212,27 @@ int s21_calc_complements(matrix_t *A, matrix_t *result);
  *
  *
  * Нахождение с помощью метода Гаусса.
+ *
+ * Для матриц до 4 × 4 определитель считается по явной формуле.
+ *
+ * Матрица A не изменяется: исключение идет в рабочем буфере. Для матриц до
+ * S21_DETERMINANT_STACK × S21_DETERMINANT_STACK буфер берется со стека,
+ * для больших - выделяется на время вызова.
  * */
 int s21_determinant(matrix_t *A, double *result);
 
+#define S21_DETERMINANT_STACK 16
+// Размер в байтах рабочего буфера s21_determinant_ws для матрицы n × n
+#define S21_DETERMINANT_WS_SIZE(n) ((size_t)(n) * (size_t)(n) * sizeof(double))
+
+/**
+ * То же, что s21_determinant, но рабочий буфер передает вызывающий:
+ * workspace должен вмещать не менее S21_DETERMINANT_WS_SIZE(A->rows) байт.
+ * Позволяет считать определители матриц одного размера в цикле без
+ * выделения памяти.
+ * */
+int s21_determinant_ws(matrix_t *A, double *result, double *workspace);
+
 /**
  * Матрицу A в степени -1 называют обратной к квадратной матрице А, если
  * произведение этих матриц равняется единичной матрице.
@@ -88,12 +240,378 @@ int s21_determinant(matrix_t *A, double *result);
  *
  * Обратной матрицы не существует, если определитель равен 0.
  *
- * Обратная матрица находится по формуле `A^{-1}=\frac{1} {|A|} × A_*^T`
+ * Матрицы больше 4 × 4 обращаются методом Гаусса-Жордана с выбором
+ * ведущего элемента по столбцу за O(n^3). Такая матрица считается
+ * вырожденной (S21_CALC_ERROR), если ведущий элемент не превосходит общего
+ * порога n × DBL_EPSILON × max|A(i,j)|.
+ *
+ * Матрицы до 4 × 4 обращаются через присоединенную: A^{-1} = adj(A) / det(A)
+ * по явным формулам. Вырожденной считается матрица с
+ * |det(A)| <= n × DBL_EPSILON × П_i max_j|A(i,j)| (произведение максимумов
+ * по строкам), поэтому масштаб отдельных строк на решение не влияет.
  * */
 int s21_inverse_matrix(matrix_t *A, matrix_t *result);
 
 /**
- * Дополнительная функция для вычисления определителя матрицы
+ * Пакетные операции над массивами из count независимых матриц одного
+ * размера: result[i] = A[i] × B[i], result[i] = det(A[i]) и
+ * result[i] = A[i]^{-1}.
+ *
+ * Аргументы проверяются один раз на весь пакет, результаты (как в вариантах
+ * _into) должны быть заранее созданы нужного размера. Рабочая память
+ * выделяется одна на вызов, а не на каждую матрицу. Крупные пакеты делятся
+ * на части и считаются на пуле потоков.
+ *
+ * Коды ошибок те же, что у одиночных операций; матрицы другого размера, чем
+ * A[0] (B[0]), дают S21_CALC_ERROR. Если в s21_inverse_batch хотя бы одна
+ * матрица вырождена, возвращается S21_CALC_ERROR: остальные обратные
+ * посчитаны, содержимое result[i] для вырожденных A[i] не определено.
+ * */
+int s21_mult_matrix_batch(matrix_t *A, matrix_t *B, matrix_t *result,
+                          int count);
+int s21_determinant_batch(matrix_t *A, double *result, int count);
+int s21_inverse_batch(matrix_t *A, matrix_t *result, int count);
+
+/**
+ * Отложенные вычисления: выражение из операций s21_* строится как граф
+ * (общие подвыражения допускаются) и считается одним вызовом
+ * s21_expr_eval.
+ *
+ * Цепочки поэлементных операций (сумма, разность, умножение на число)
+ * сливаются в один проход по памяти: значения считаются плитками, которые
+ * помещаются в кэш, без промежуточных матриц. Произведение матриц - граница
+ * слияния: его аргументы и результат считаются целиком, один раз на
+ * вычисление, даже если узел используется несколько раз.
+ *
+ * Узлы принадлежат графу и освобождаются s21_expr_destroy. Листья ссылаются
+ * на матрицы без копирования, поэтому матрицы должны жить до вычисления.
+ * Конструкторы возвращают NULL только при нехватке памяти или NULL
+ * аргументах; несовпадение размеров запоминается в узле и возвращается
+ * s21_expr_eval как S21_CALC_ERROR.
+ * */
+typedef struct s21_expr_node s21_expr_t;
+
+typedef struct s21_expr_graph_struct {
+  s21_expr_t *nodes;  // Все узлы графа
+} s21_expr_graph_t;
+
+void s21_expr_init(s21_expr_graph_t *graph);
+void s21_expr_destroy(s21_expr_graph_t *graph);
+s21_expr_t *s21_expr_matrix(s21_expr_graph_t *graph, matrix_t *A);
+s21_expr_t *s21_expr_sum(s21_expr_graph_t *graph, s21_expr_t *A,
+                         s21_expr_t *B);
+s21_expr_t *s21_expr_sub(s21_expr_graph_t *graph, s21_expr_t *A,
+                         s21_expr_t *B);
+s21_expr_t *s21_expr_mult_number(s21_expr_graph_t *graph, s21_expr_t *A,
+                                 double number);
+s21_expr_t *s21_expr_mult_matrix(s21_expr_graph_t *graph, s21_expr_t *A,
+                                 s21_expr_t *B);
+// @brief Вычисляет выражение в новую матрицу result
+int s21_expr_eval(s21_expr_t *expr, matrix_t *result);
+
+/**
+ * LU-разложение с выбором ведущего элемента по столбцу: P × A = L × U.
+ *
+ * L (единичная нижнетреугольная, без диагонали) и U хранятся вместе в lu.
+ * perm[i] - номер строки исходной матрицы, стоящей на i-м месте после
+ * перестановок; sign = (-1)^(число перестановок). singular = 1, если
+ * найден ведущий элемент, неотличимый от нуля.
+ *
+ * Одно разложение можно использовать для определителя, решения систем и
+ * обратной матрицы без повторного разложения.
+ * */
+typedef struct s21_lu_struct {
+  matrix_t lu;
+  int *perm;
+  int sign;
+  int singular;
+} s21_lu_t;
+
+// @brief Раскладывает квадратную матрицу A, сама A не изменяется.
+//
+// @return S21_OK, S21_ERROR для некорректной матрицы, S21_CALC_ERROR для
+// неквадратной
+int s21_lu_factor(matrix_t *A, s21_lu_t *lu);
+// @brief Освобождает ресурсы разложения
+void s21_lu_remove(s21_lu_t *lu);
+// @brief Определитель по готовому разложению за O(n)
+int s21_lu_det(s21_lu_t *lu, double *result);
+// @brief Решает A × X = B для всех столбцов B сразу за O(n^2) на столбец.
+// Для вырожденной матрицы возвращает S21_CALC_ERROR.
+int s21_lu_solve(s21_lu_t *lu, matrix_t *B, matrix_t *X);
+// @brief Обратная матрица по готовому разложению за O(n^3).
+// Для вырожденной матрицы возвращает S21_CALC_ERROR.
+int s21_lu_inverse(s21_lu_t *lu, matrix_t *result);
+
+/**
+ * QR-разложение матрицы A размера m × n (m >= n) отражениями Хаусхолдера:
+ * A = Q × R, Q - m × n с ортонормированными столбцами, R - n × n
+ * верхнетреугольная.
+ *
+ * Разложение блочное: отражения панели собираются в компактное
+ * WY-представление E - V × T × V^T и применяются к остальным столбцам двумя
+ * блочными умножениями, которые проходят по высоте матрицы потоком. Для
+ * матрицы с m < n - S21_CALC_ERROR.
+ * */
+int s21_qr(matrix_t *A, matrix_t *Q, matrix_t *R);
+/**
+ * Решение задачи наименьших квадратов min ||A × X - B|| для всех столбцов B
+ * (A - m × n, m >= n, B - m × k, X - n × k) через QR-разложение:
+ * X = R^{-1} × (Q^T × B). В отличие от нормальных уравнений A^T × A не
+ * строится и число обусловленности не возводится в квадрат. [A | B]
+ * проходит блоками строк размером порядка L2 (TSQR): копии A и B целиком
+ * не делаются, Q^T × B накапливается вместе с R.
+ *
+ * @return S21_CALC_ERROR, если m < n, число строк B не равно m или ранг A
+ * неполный (|R(i,i)| <= m × DBL_EPSILON × max|R(i,i)|)
+ * */
+int s21_lstsq(matrix_t *A, matrix_t *B, matrix_t *X);
+
+/**
+ * Разложение Холецкого симметричной положительно определенной матрицы:
+ * A = L × L^T, L - нижнетреугольная с положительной диагональю (над
+ * диагональю нули).
+ *
+ * Читается только нижний треугольник A (симметрия не проверяется), и
+ * разложение обновляет только нижний треугольник, поэтому арифметики вдвое
+ * меньше, чем в LU. Разложение блочное: обновление остатка идет через
+ * блочное умножение s21_dgemm.
+ *
+ * @return S21_OK; S21_ERROR для некорректной матрицы; S21_CALC_ERROR для
+ * неквадратной матрицы или если A не положительно определенная (ведущий
+ * элемент не больше n × DBL_EPSILON × max|A(i,i)|)
+ * */
+int s21_cholesky(matrix_t *A, matrix_t *L);
+// @brief Решает A × X = B по множителю L сразу для всех столбцов B
+int s21_cholesky_solve(matrix_t *L, matrix_t *B, matrix_t *X);
+// @brief Обратная матрица A^{-1} по множителю L
+int s21_cholesky_inverse(matrix_t *L, matrix_t *result);
+// @brief ln(det(A)) = 2 × сумма ln(L(i,i)); не переполняется для больших
+// матриц, у которых сам определитель не представим в double
+int s21_cholesky_logdet(matrix_t *L, double *result);
+
+/**
+ * Решение системы A × X = B сразу для всех столбцов B: LU-разложение A с
+ * выбором ведущего элемента и блочные подстановки по всем правым частям
+ * (O(n^3 + n^2 × B.columns), без обратной матрицы). X создается размера
+ * B.rows × B.columns.
+ *
+ * @return S21_OK; S21_ERROR для некорректных матриц; S21_CALC_ERROR, если A
+ * не квадратная, число строк B не равно порядку A или A вырождена (тот же
+ * порог, что у s21_lu_factor)
+ * */
+int s21_solve(matrix_t *A, matrix_t *B, matrix_t *X);
+
+/**
+ * Матрицы одинарной точности: вдвое меньше памяти и вдвое больше элементов
+ * в одном векторном регистре. Хранение то же, что у matrix_t: один блок,
+ * данные выровнены по S21_ALIGNMENT.
+ *
+ * Функции повторяют одноименные функции matrix_t и возвращают те же коды.
+ * Определитель и обратная считаются в double (результат обратной
+ * округляется до float), определитель возвращается в double.
+ * */
+typedef struct matrix_f32_struct {
+  float **matrix;
+  int rows;
+  int columns;
+} matrix_f32_t;
+
+#define EPSILON_F32 1e-4f  // Погрешность сравнения для float
+
+int s21_create_matrix_f32(int rows, int columns, matrix_f32_t *result);
+void s21_remove_matrix_f32(matrix_f32_t *A);
+int s21_eq_matrix_f32(matrix_f32_t *A, matrix_f32_t *B);
+int s21_sum_matrix_f32(matrix_f32_t *A, matrix_f32_t *B,
+                       matrix_f32_t *result);
+int s21_sub_matrix_f32(matrix_f32_t *A, matrix_f32_t *B,
+                       matrix_f32_t *result);
+int s21_mult_number_f32(matrix_f32_t *A, float number, matrix_f32_t *result);
+int s21_mult_matrix_f32(matrix_f32_t *A, matrix_f32_t *B,
+                        matrix_f32_t *result);
+int s21_transpose_f32(matrix_f32_t *A, matrix_f32_t *result);
+int s21_determinant_f32(matrix_f32_t *A, double *result);
+int s21_inverse_matrix_f32(matrix_f32_t *A, matrix_f32_t *result);
+
+// @brief Преобразование между matrix_t и matrix_f32_t в новую матрицу
+// result. При переходе к float значения округляются.
+int s21_matrix_to_f32(matrix_t *A, matrix_f32_t *result);
+int s21_matrix_from_f32(matrix_f32_t *A, matrix_t *result);
+
+// Точность накопления сумм в s21_gemm_f32
+#define S21_ACCUMULATE_F32 0
+#define S21_ACCUMULATE_F64 1
+
+/**
+ * C = alpha × op(A) × op(B) + beta × C для float, правила те же, что у
+ * s21_gemm.
+ *
+ * S21_ACCUMULATE_F32 - суммы накапливаются во float (быстрее всего).
+ * S21_ACCUMULATE_F64 - куски A и B расширяются до double и суммы
+ * накапливаются в double, во float округляется только результат: ошибка не
+ * растет с длиной сумм. Требует временный буфер rows × columns double.
+ * */
+int s21_gemm_f32(float alpha, matrix_f32_t *A, int transA, matrix_f32_t *B,
+                 int transB, float beta, matrix_f32_t *C, int accumulate);
+
+/**
+ * Двоичный формат файла матрицы.
+ *
+ * Заголовок 64 байта (целые в порядке байтов машины, записавшей файл):
+ *   0  char[8]   "S21MATRX"
+ *   8  uint32    версия формата (1)
+ *   12 uint32    тип элементов: S21_DTYPE_F64 или S21_DTYPE_F32
+ *   16 uint32    0x01020304 - проверка порядка байтов
+ *   20 uint32    выравнивание данных в файле (S21_ALIGNMENT)
+ *   24 uint64    rows
+ *   32 uint64    columns
+ *   40 uint64    смещение данных от начала файла (кратно выравниванию)
+ *   48 uint8[16] резерв, нули
+ * Затем rows × columns элементов по строкам без промежутков.
+ *
+ * Ошибки: S21_ERROR - некорректные аргументы или нет памяти, S21_CALC_ERROR -
+ * файл не открывается, не читается/записывается или не в этом формате
+ * (другой тип элементов, порядок байтов, усеченные данные).
+ * */
+#define S21_FILE_HEADER_SIZE 64
+#define S21_DTYPE_F64 1
+#define S21_DTYPE_F32 2
+
+// @brief Записывает матрицу в файл path (файл перезаписывается)
+int s21_save_matrix(const char *path, matrix_t *A);
+// @brief Читает файл в новую матрицу, созданную s21_create_matrix
+int s21_load_matrix(const char *path, matrix_t *result);
+// @brief Отображает файл в память (mmap) без копирования: данные читаются с
+// диска по мере обращения к ним. Матрица только для чтения - запись в нее
+// завершает процесс по SIGSEGV, - и удаляется только через
+// s21_unmap_matrix. Изменения файла другими процессами видны в матрице.
+int s21_map_matrix(const char *path, matrix_t *result);
+// @brief Освобождает матрицу, полученную s21_map_matrix
+void s21_unmap_matrix(matrix_t *A);
+// @brief То же для float
+int s21_save_matrix_f32(const char *path, matrix_f32_t *A);
+int s21_load_matrix_f32(const char *path, matrix_f32_t *result);
+int s21_map_matrix_f32(const char *path, matrix_f32_t *result);
+void s21_unmap_matrix_f32(matrix_f32_t *A);
+
+/**
+ * Текстовый ввод-вывод: числа в строке разделяются пробелами, табуляциями,
+ * запятыми или точками с запятой, строки матрицы - переводом строки (\n или
+ * \r\n). Десятичный разделитель всегда точка, независимо от локали.
+ * */
+// @brief Читает матрицу из файлового дескриптора до конца файла крупными
+// блоками; размеры определяются по тексту за один проход, пустые строки
+// пропускаются. S21_CALC_ERROR - ошибка чтения, пустой текст, не число,
+// пустое поле между запятыми или строки разной длины.
+int s21_read_matrix_fd(int fd, matrix_t *result);
+// @brief Пишет матрицу в файловый дескриптор: separator (' ', '\t', ',' или
+// ';') между числами, '\n' после каждой строки. Числа записываются так, что
+// s21_read_matrix_fd восстанавливает их без потерь.
+int s21_write_matrix_fd(int fd, matrix_t *A, char separator);
+
+// @brief Произведение матриц, хранящихся в файлах двоичного формата (double):
+// c_path = a_path × b_path, без загрузки матриц в память целиком. Считается
+// по плиткам: пока считается одна плитка C, отдельный поток читает плитки A
+// и B следующего шага и пишет готовые плитки C. memory_budget - байт на
+// буферы плиток (по два для A, B и C); буферы упаковки s21_dgemm растут с
+// размером плитки и в бюджет не входят. Бюджет меньше 48 КиБ - S21_ERROR;
+// несовпадающие размеры или c_path, совпадающий с множителем, -
+// S21_CALC_ERROR. При ошибке содержимое c_path не определено.
+int s21_mult_matrix_file(const char *a_path, const char *b_path,
+                         const char *c_path, size_t memory_budget);
+
+/**
+ * Разреженные матрицы в форматах CSR (по строкам) и CSC (по столбцам).
+ *
+ * Хранятся только ненулевые элементы: для CSR offsets[i]..offsets[i + 1] -
+ * диапазон элементов i-й строки в indices (номера столбцов по возрастанию)
+ * и values; для CSC то же по столбцам с номерами строк. Память -
+ * O(rows + nnz) вместо O(rows × columns).
+ * */
+#define S21_CSR 0
+#define S21_CSC 1
+
+typedef struct sparse_struct {
+  int rows;
+  int columns;
+  int nnz;  // Число хранимых элементов
+  int format;
+  int *offsets;  // rows + 1 (CSR) или columns + 1 (CSC) элементов
+  int *indices;
+  double *values;
+} sparse_t;
+
+// @brief Строит матрицу из троек (row[t], column[t], values[t]); повторные
+// позиции суммируются. Индекс вне матрицы - S21_CALC_ERROR. Построение
+// за O(count + rows + columns) без сравнений.
+int s21_sparse_from_triplets(int rows, int columns, int count,
+                             const int *row, const int *column,
+                             const double *values, int format,
+                             sparse_t *result);
+// @brief Преобразование плотной матрицы (нули не хранятся) и обратно
+int s21_sparse_from_dense(matrix_t *A, int format, sparse_t *result);
+int s21_sparse_to_dense(sparse_t *A, matrix_t *result);
+// @brief Копия матрицы в формате format (CSR <-> CSC за O(nnz))
+int s21_sparse_convert(sparse_t *A, int format, sparse_t *result);
+void s21_sparse_remove(sparse_t *A);
+
+// @brief y = A × x; x из A.columns элементов, y из A.rows элементов, x и y
+// не должны совпадать. Для CSR строки делятся между потоками так, чтобы
+// на каждый приходилось примерно поровну ненулевых элементов.
+int s21_sparse_mult_vector(sparse_t *A, const double *x, double *y);
+// @brief Произведение разреженной и плотной матрицы в новую матрицу result
+int s21_sparse_mult_matrix(sparse_t *A, matrix_t *B, matrix_t *result);
+
+// @brief Задает число потоков для параллельных операций (произведение
+// матриц и т.д.), включая вызывающий поток. threads < 1 - по умолчанию:
+// значение переменной окружения S21_NUM_THREADS или число процессоров.
+// Нельзя вызывать одновременно с вычислениями в других потоках.
+//
+// @return установленное число потоков
+int s21_set_num_threads(int threads);
+// @brief Текущее число потоков для параллельных операций
+int s21_get_num_threads(void);
+
+// Алгоритм s21_mult_matrix и s21_mult_matrix_into
+#define S21_MULT_CLASSIC 0
+#define S21_MULT_STRASSEN 1
+
+// @brief Выбирает алгоритм произведения матриц. S21_MULT_STRASSEN включает
+// рекурсию Штрассена-Винограда для произведений, у которых все размеры не
+// меньше порога (s21_set_strassen_cutoff): она быстрее на больших матрицах,
+// но ошибка округления растет с глубиной рекурсии, поэтому по умолчанию
+// используется S21_MULT_CLASSIC. s21_gemm всегда классический.
+//
+// @return установленный алгоритм
+int s21_set_mult_algorithm(int algorithm);
+// @brief Текущий алгоритм произведения матриц
+int s21_get_mult_algorithm(void);
+// @brief Порог рекурсии Штрассена: блоки, у которых хотя бы один размер
+// меньше cutoff, умножаются классически. cutoff < 1 - по умолчанию (512).
+//
+// @return установленный порог
+int s21_set_strassen_cutoff(int cutoff);
+
+// Уровни векторных ядер поэлементных операций
+#define S21_SIMD_SCALAR 0
+#define S21_SIMD_SSE2 1
+#define S21_SIMD_AVX2 2
+#define S21_SIMD_AVX512 3
+
+// @brief Текущий уровень векторных ядер. При загрузке выбирается лучший
+// уровень, который поддерживает процессор (по CPUID).
+int s21_simd_level(void);
+
+// @brief Принудительно понижает уровень векторных ядер (например, для
+// сравнения результатов). Уровень выше поддерживаемого процессором
+// ограничивается сверху.
+//
+// @return фактически установленный уровень
+int s21_simd_set_level(int level);
+
+/**
+ * Дополнительная функция для вычисления матрицы алгебраических дополнений:
+ * заполняет уже созданную матрицу result того же размера, что и A
  * */
 int option_calc_complements(matrix_t *A, matrix_t *result);
 #endif
\ No newline at end of file
@@ -0,0 +1,237 @@
+#include "s21_internal.h"
+
+static int f32_valid(const matrix_f32_t *A) {
+  return A != NULL && A->matrix != NULL && A->rows >= 1 && A->columns >= 1;
+}
+
+int s21_create_matrix_f32(int rows, int columns, matrix_f32_t *result) {
+  int code = S21_OK;
+  size_t size = s21_slab_size(rows, columns, sizeof(float));
+  void *block = NULL;
+  if (result == NULL || size == 0) {
+    code = S21_ERROR;
+  } else {
+    block = calloc(1, size);
+    if (block == NULL) code = S21_ERROR;
+  }
+  if (code == S21_OK) {
+    s21_slab_attach(block, rows, columns, sizeof(float), S21_OWNER_HEAP);
+    result->matrix = (float **)block;
+    result->rows = rows;
+    result->columns = columns;
+  } else if (result != NULL) {
+    result->matrix = NULL;
+    result->rows = 0;
+    result->columns = 0;
+  }
+  return code;
+}
+
+void s21_remove_matrix_f32(matrix_f32_t *A) {
+  if (A != NULL) {
+    free(A->matrix);  // Строки лежат в том же блоке
+    A->matrix = NULL;
+    A->rows = 0;
+    A->columns = 0;
+  }
+}
+
+int s21_eq_matrix_f32(matrix_f32_t *A, matrix_f32_t *B) {
+  int code = SUCCESS;
+  if (!f32_valid(A) || !f32_valid(B)) {
+    code = FAILURE;
+  } else if (A->rows != B->rows || A->columns != B->columns) {
+    code = FAILURE;
+  } else {
+    code = s21_vec_eq_f32(A->matrix[0], B->matrix[0],
+                          (size_t)A->rows * A->columns, EPSILON_F32);
+  }
+  return code;
+}
+
+static int elementwise_f32(matrix_f32_t *A, matrix_f32_t *B,
+                           matrix_f32_t *result,
+                           void (*kernel)(const float *, const float *,
+                                          float *, size_t)) {
+  int code = S21_OK;
+  if (!f32_valid(A) || !f32_valid(B) || result == NULL) {
+    code = S21_ERROR;
+  } else if (A->rows != B->rows || A->columns != B->columns) {
+    code = S21_CALC_ERROR;
+  } else {
+    code = s21_create_matrix_f32(A->rows, A->columns, result);
+  }
+  if (code == S21_OK) {
+    kernel(A->matrix[0], B->matrix[0], result->matrix[0],
+           (size_t)A->rows * A->columns);
+  }
+  return code;
+}
+
+int s21_sum_matrix_f32(matrix_f32_t *A, matrix_f32_t *B,
+                       matrix_f32_t *result) {
+  return elementwise_f32(A, B, result, s21_vec_add_f32);
+}
+
+int s21_sub_matrix_f32(matrix_f32_t *A, matrix_f32_t *B,
+                       matrix_f32_t *result) {
+  return elementwise_f32(A, B, result, s21_vec_sub_f32);
+}
+
+int s21_mult_number_f32(matrix_f32_t *A, float number, matrix_f32_t *result) {
+  int code = S21_OK;
+  if (!f32_valid(A) || result == NULL) {
+    code = S21_ERROR;
+  } else {
+    code = s21_create_matrix_f32(A->rows, A->columns, result);
+  }
+  if (code == S21_OK) {
+    s21_vec_scale_f32(A->matrix[0], number, result->matrix[0],
+                      (size_t)A->rows * A->columns);
+  }
+  return code;
+}
+
+int s21_gemm_f32(float alpha, matrix_f32_t *A, int transA, matrix_f32_t *B,
+                 int transB, float beta, matrix_f32_t *C, int accumulate) {
+  int code = S21_OK;
+  if (!f32_valid(A) || !f32_valid(B) || !f32_valid(C)) {
+    code = S21_ERROR;
+  }
+  int m = 0;
+  int k = 0;
+  int n = 0;
+  if (code == S21_OK) {
+    m = transA ? A->columns : A->rows;
+    k = transA ? A->rows : A->columns;
+    n = transB ? B->rows : B->columns;
+    if ((transB ? B->columns : B->rows) != k || C->rows != m ||
+        C->columns != n) {
+      code = S21_CALC_ERROR;
+    } else if (C->matrix == A->matrix || C->matrix == B->matrix) {
+      code = S21_CALC_ERROR;  // C не может совпадать с множителем
+    }
+  }
+  if (code == S21_OK) {
+    ptrdiff_t lda = A->columns;
+    ptrdiff_t ldb = B->columns;
+    ptrdiff_t rsa = transA ? 1 : lda;
+    ptrdiff_t csa = transA ? lda : 1;
+    ptrdiff_t rsb = transB ? 1 : ldb;
+    ptrdiff_t csb = transB ? ldb : 1;
+    if (accumulate == S21_ACCUMULATE_F64) {
+      code = s21_sgemm_wide(m, n, k, alpha, A->matrix[0], rsa, csa,
+                            B->matrix[0], rsb, csb, beta, C->matrix[0], n);
+    } else {
+      code = s21_sgemm(m, n, k, alpha, A->matrix[0], rsa, csa, B->matrix[0],
+                       rsb, csb, beta, C->matrix[0], n);
+    }
+  }
+  return code;
+}
+
+int s21_mult_matrix_f32(matrix_f32_t *A, matrix_f32_t *B,
+                        matrix_f32_t *result) {
+  int code = S21_OK;
+  if (!f32_valid(A) || !f32_valid(B) || result == NULL) {
+    code = S21_ERROR;
+  } else if (A->columns != B->rows) {
+    code = S21_CALC_ERROR;
+  } else {
+    code = s21_create_matrix_f32(A->rows, B->columns, result);
+  }
+  if (code == S21_OK) {
+    code = s21_sgemm(A->rows, B->columns, A->columns, 1.0f, A->matrix[0],
+                     A->columns, 1, B->matrix[0], B->columns, 1, 0.0f,
+                     result->matrix[0], result->columns);
+    if (code != S21_OK) s21_remove_matrix_f32(result);
+  }
+  return code;
+}
+
+int s21_transpose_f32(matrix_f32_t *A, matrix_f32_t *result) {
+  int code = S21_OK;
+  if (!f32_valid(A) || result == NULL) {
+    code = S21_ERROR;
+  } else {
+    code = s21_create_matrix_f32(A->columns, A->rows, result);
+  }
+  if (code == S21_OK) {
+    s21_transpose_block_f32(A->matrix[0], A->columns, result->matrix[0],
+                            result->columns, A->rows, A->columns);
+  }
+  return code;
+}
+
+int s21_matrix_to_f32(matrix_t *A, matrix_f32_t *result) {
+  int code = S21_OK;
+  if (A == NULL || A->matrix == NULL || result == NULL) {
+    code = S21_ERROR;
+  } else {
+    code = s21_create_matrix_f32(A->rows, A->columns, result);
+  }
+  if (code == S21_OK) {
+    const double *src = A->matrix[0];
+    float *dst = result->matrix[0];
+    size_t count = (size_t)A->rows * A->columns;
+    for (size_t i = 0; i < count; i++) dst[i] = (float)src[i];
+  }
+  return code;
+}
+
+int s21_matrix_from_f32(matrix_f32_t *A, matrix_t *result) {
+  int code = S21_OK;
+  if (!f32_valid(A) || result == NULL) {
+    code = S21_ERROR;
+  } else {
+    code = s21_create_matrix(A->rows, A->columns, result);
+  }
+  if (code == S21_OK) {
+    const float *src = A->matrix[0];
+    double *dst = result->matrix[0];
+    size_t count = (size_t)A->rows * A->columns;
+    for (size_t i = 0; i < count; i++) dst[i] = src[i];
+  }
+  return code;
+}
+
+// Определитель и обратная считаются в double: исключение Гаусса во float
+// теряет точность уже на матрицах среднего размера
+int s21_determinant_f32(matrix_f32_t *A, double *result) {
+  int code = S21_OK;
+  matrix_t wide = {0};
+  if (A == NULL || result == NULL || A->rows < 1 || A->rows != A->columns) {
+    code = S21_ERROR;
+  } else if (A->matrix == NULL) {
+    code = S21_CALC_ERROR;
+  } else {
+    code = s21_matrix_from_f32(A, &wide);
+  }
+  if (code == S21_OK) {
+    code = s21_determinant(&wide, result);
+    s21_remove_matrix(&wide);
+  }
+  return code;
+}
+
+int s21_inverse_matrix_f32(matrix_f32_t *A, matrix_f32_t *result) {
+  int code = S21_OK;
+  matrix_t wide = {0};
+  matrix_t inverse = {0};
+  if (!f32_valid(A) || result == NULL) {
+    code = S21_ERROR;
+  } else if (A->rows != A->columns) {
+    code = S21_CALC_ERROR;
+  } else {
+    code = s21_matrix_from_f32(A, &wide);
+  }
+  if (code == S21_OK) {
+    code = s21_inverse_matrix(&wide, &inverse);
+    s21_remove_matrix(&wide);
+  }
+  if (code == S21_OK) {
+    code = s21_matrix_to_f32(&inverse, result);
+    s21_remove_matrix(&inverse);
+  }
+  return code;
+}
@@ -0,0 +1,318 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "s21_internal.h"
+
+#define S21_OOC_MIN_TILE 32  // Меньшие плитки не окупают вызов s21_dgemm
+#define S21_OOC_OPS 3        // Операций в одном задании потока ввода-вывода
+
+// Плитка rows × columns с левым верхним углом (row, column) матрицы из
+// файла fd (columns_total столбцов, данные со смещения offset) в буфере
+// buffer по строкам без промежутков
+typedef struct {
+  int fd;
+  size_t offset;
+  int columns_total;
+  int row;
+  int column;
+  int rows;
+  int columns;
+  double *buffer;
+  int write;  // 1 - записать буфер в файл, 0 - прочитать
+} tile_op;
+
+// Поток ввода-вывода: выполняет одно задание (до S21_OOC_OPS операций с
+// плитками), пока вызывающий поток считает
+typedef struct {
+  pthread_t thread;
+  pthread_mutex_t lock;
+  pthread_cond_t wake;  // Новое задание или остановка
+  pthread_cond_t done;  // Задание выполнено
+  tile_op ops[S21_OOC_OPS];
+  int count;
+  int pending;  // Задание выдано и еще не выполнено
+  int stop;
+  int status;  // Первая ошибка ввода-вывода
+} io_worker;
+
+// Строки плитки лежат в файле по отдельности: одна pread/pwrite на строку
+static int run_op(const tile_op *op) {
+  int code = S21_OK;
+  size_t length = (size_t)op->columns * sizeof(double);
+  for (int i = 0; i < op->rows && code == S21_OK; i++) {
+    char *bytes = (char *)(op->buffer + (size_t)i * op->columns);
+    off_t position =
+        (off_t)(op->offset +
+                ((size_t)(op->row + i) * op->columns_total + op->column) *
+                    sizeof(double));
+    size_t left = length;
+    while (left > 0 && code == S21_OK) {
+      ssize_t done = op->write ? pwrite(op->fd, bytes, left, position)
+                               : pread(op->fd, bytes, left, position);
+      if (done > 0) {
+        bytes += done;
+        position += done;
+        left -= (size_t)done;
+      } else if (done == 0 || errno != EINTR) {
+        code = S21_CALC_ERROR;
+      }
+    }
+  }
+  return code;
+}
+
+static void *io_main(void *arg) {
+  io_worker *io = (io_worker *)arg;
+  pthread_mutex_lock(&io->lock);
+  while (!io->stop) {
+    if (io->pending) {
+      tile_op ops[S21_OOC_OPS];
+      int count = io->count;
+      memcpy(ops, io->ops, sizeof(ops));
+      pthread_mutex_unlock(&io->lock);
+      int code = S21_OK;
+      for (int i = 0; i < count && code == S21_OK; i++) code = run_op(&ops[i]);
+      pthread_mutex_lock(&io->lock);
+      if (io->status == S21_OK) io->status = code;
+      io->pending = 0;
+      pthread_cond_broadcast(&io->done);
+    } else {
+      pthread_cond_wait(&io->wake, &io->lock);
+    }
+  }
+  pthread_mutex_unlock(&io->lock);
+  return NULL;
+}
+
+// Ждет выполнения выданного задания; @return первая ошибка ввода-вывода
+static int io_wait(io_worker *io) {
+  pthread_mutex_lock(&io->lock);
+  while (io->pending) pthread_cond_wait(&io->done, &io->lock);
+  int code = io->status;
+  pthread_mutex_unlock(&io->lock);
+  return code;
+}
+
+static void io_submit(io_worker *io, const tile_op *ops, int count) {
+  io_wait(io);
+  pthread_mutex_lock(&io->lock);
+  memcpy(io->ops, ops, (size_t)count * sizeof(tile_op));
+  io->count = count;
+  io->pending = count > 0;
+  pthread_cond_signal(&io->wake);
+  pthread_mutex_unlock(&io->lock);
+}
+
+// Файловые матрицы произведения (A - m × k, B - k × n, C - m × n) и
+// размеры плиток
+typedef struct {
+  int fd[3];  // A, B, C
+  size_t offset[3];
+  int m;
+  int n;
+  int k;
+  int tm;
+  int tn;
+  int tk;
+} ooc_job;
+
+// Номер шага s разворачивается в плитку C (i, j) и панель k; для одной плитки
+// C шаги по k идут подряд
+static void step_tiles(const ooc_job *job, long step, int *i, int *j,
+                       int *p) {
+  long k_steps = (job->k + job->tk - 1) / job->tk;
+  long n_steps = (job->n + job->tn - 1) / job->tn;
+  *p = (int)(step % k_steps) * job->tk;
+  *j = (int)(step / k_steps % n_steps) * job->tn;
+  *i = (int)(step / k_steps / n_steps) * job->tm;
+}
+
+static tile_op make_op(const ooc_job *job, int which, int row, int column,
+                       int rows, int columns, double *buffer) {
+  tile_op op = {.fd = job->fd[which],
+                .offset = job->offset[which],
+                .columns_total = which == 0 ? job->k : job->n,
+                .row = row,
+                .column = column,
+                .rows = rows,
+                .columns = columns,
+                .buffer = buffer,
+                .write = which == 2};
+  return op;
+}
+
+static int min_int(int a, int b) { return a < b ? a : b; }
+
+// Основной цикл: на шаге s поток ввода-вывода читает плитки A и B шага s + 1
+// во вторые буферы и пишет готовую плитку C предыдущего шага, пока здесь
+// считается C(i, j) += A(i, p) × B(p, j). Плитка A, совпадающая с текущей,
+// не перечитывается.
+static int multiply_tiles(ooc_job *job, io_worker *io, double *buffers[6]) {
+  int code = S21_OK;
+  long steps = (long)((job->m + job->tm - 1) / job->tm) *
+               ((job->n + job->tn - 1) / job->tn) *
+               ((job->k + job->tk - 1) / job->tk);
+  double **a = buffers;
+  double **b = buffers + 2;
+  double **c = buffers + 4;
+  int a_slot = 0;
+  int b_slot = 0;
+  int c_slot = 0;
+  tile_op finished = {0};  // Готовая плитка C, ожидающая записи
+  int has_finished = 0;
+  int i = 0;
+  int j = 0;
+  int p = 0;
+  step_tiles(job, 0, &i, &j, &p);
+  tile_op first[2] = {
+      make_op(job, 0, i, p, min_int(job->tm, job->m - i),
+              min_int(job->tk, job->k - p), a[0]),
+      make_op(job, 1, p, j, min_int(job->tk, job->k - p),
+              min_int(job->tn, job->n - j), b[0])};
+  io_submit(io, first, 2);
+  for (long step = 0; step < steps && code == S21_OK; step++) {
+    code = io_wait(io);
+    int rows = min_int(job->tm, job->m - i);
+    int columns = min_int(job->tn, job->n - j);
+    int depth = min_int(job->tk, job->k - p);
+    tile_op ops[S21_OOC_OPS];
+    int count = 0;
+    int ni = 0;
+    int nj = 0;
+    int np = 0;
+    int next_a = a_slot;
+    int next_b = 1 - b_slot;
+    if (has_finished) {
+      ops[count++] = finished;
+      has_finished = 0;
+    }
+    if (step + 1 < steps) {
+      step_tiles(job, step + 1, &ni, &nj, &np);
+      if (ni != i || np != p) {
+        next_a = 1 - a_slot;
+        ops[count++] = make_op(job, 0, ni, np, min_int(job->tm, job->m - ni),
+                               min_int(job->tk, job->k - np), a[next_a]);
+      }
+      ops[count++] = make_op(job, 1, np, nj, min_int(job->tk, job->k - np),
+                             min_int(job->tn, job->n - nj), b[next_b]);
+    }
+    if (code == S21_OK) {
+      io_submit(io, ops, count);
+      code = s21_dgemm(rows, columns, depth, 1.0, a[a_slot], depth, 1,
+                       b[b_slot], columns, 1, p == 0 ? 0.0 : 1.0, c[c_slot],
+                       columns);
+    }
+    if (code == S21_OK && p + depth == job->k) {
+      finished = make_op(job, 2, i, j, rows, columns, c[c_slot]);
+      has_finished = 1;
+      c_slot = 1 - c_slot;
+    }
+    a_slot = next_a;
+    b_slot = next_b;
+    i = ni;
+    j = nj;
+    p = np;
+  }
+  if (code == S21_OK && has_finished) io_submit(io, &finished, 1);
+  int io_code = io_wait(io);
+  if (code == S21_OK) code = io_code;
+  return code;
+}
+
+// Сторона плитки: шесть буферов (по два для A, B и C) t × t double в бюджете
+static int tile_side(size_t budget) {
+  size_t side = (size_t)sqrt((double)(budget / (6 * sizeof(double))));
+  while (side > 0 && 6 * side * side * sizeof(double) > budget) side--;
+  if (side > INT32_MAX / 2) side = INT32_MAX / 2;
+  // Кратно ширине микроядра s21_dgemm
+  if (side >= 64) side &= ~(size_t)7;
+  return (int)side;
+}
+
+// Файл path не является уже открытым файлом fd (иначе его создание заново
+// стерло бы множитель)
+static int same_file(const char *path, int fd) {
+  struct stat a;
+  struct stat b;
+  return stat(path, &a) == 0 && fstat(fd, &b) == 0 && a.st_dev == b.st_dev &&
+         a.st_ino == b.st_ino;
+}
+
+static int run_job(ooc_job *job, int side) {
+  int code = S21_OK;
+  io_worker io = {.lock = PTHREAD_MUTEX_INITIALIZER,
+                  .wake = PTHREAD_COND_INITIALIZER,
+                  .done = PTHREAD_COND_INITIALIZER};
+  job->tm = min_int(side, job->m);
+  job->tn = min_int(side, job->n);
+  job->tk = min_int(side, job->k);
+  size_t a_size = (size_t)job->tm * job->tk;
+  size_t b_size = (size_t)job->tk * job->tn;
+  size_t c_size = (size_t)job->tm * job->tn;
+  double *block =
+      (double *)malloc(2 * (a_size + b_size + c_size) * sizeof(double));
+  if (block == NULL) {
+    code = S21_ERROR;
+  } else if (pthread_create(&io.thread, NULL, io_main, &io) != 0) {
+    code = S21_ERROR;
+  } else {
+    double *buffers[6] = {block,
+                          block + a_size,
+                          block + 2 * a_size,
+                          block + 2 * a_size + b_size,
+                          block + 2 * (a_size + b_size),
+                          block + 2 * (a_size + b_size) + c_size};
+    code = multiply_tiles(job, &io, buffers);
+    pthread_mutex_lock(&io.lock);
+    io.stop = 1;
+    pthread_cond_signal(&io.wake);
+    pthread_mutex_unlock(&io.lock);
+    pthread_join(io.thread, NULL);
+  }
+  free(block);
+  return code;
+}
+
+int s21_mult_matrix_file(const char *a_path, const char *b_path,
+                         const char *c_path, size_t memory_budget) {
+  int code = S21_OK;
+  ooc_job job = {.fd = {-1, -1, -1}};
+  int b_rows = 0;
+  int side = tile_side(memory_budget);
+  if (a_path == NULL || b_path == NULL || c_path == NULL ||
+      side < S21_OOC_MIN_TILE) {
+    code = S21_ERROR;
+  } else {
+    code = s21_file_open(a_path, O_RDONLY, S21_DTYPE_F64, &job.fd[0], &job.m,
+                         &job.k, &job.offset[0]);
+  }
+  if (code == S21_OK) {
+    code = s21_file_open(b_path, O_RDONLY, S21_DTYPE_F64, &job.fd[1], &b_rows,
+                         &job.n, &job.offset[1]);
+  }
+  if (code == S21_OK &&
+      (b_rows != job.k || same_file(c_path, job.fd[0]) ||
+       same_file(c_path, job.fd[1]))) {
+    code = S21_CALC_ERROR;
+  }
+  if (code == S21_OK) {
+    code = s21_file_create(c_path, S21_DTYPE_F64, job.m, job.n, &job.fd[2]);
+    job.offset[2] = S21_FILE_HEADER_SIZE;
+  }
+  if (code == S21_OK) {
+    // Файл C сразу получает полный размер, плитки пишутся на свои места
+    size_t size =
+        S21_FILE_HEADER_SIZE + (size_t)job.m * job.n * sizeof(double);
+    if (ftruncate(job.fd[2], (off_t)size) != 0) code = S21_CALC_ERROR;
+  }
+  if (code == S21_OK) code = run_job(&job, side);
+  for (int i = 0; i < 3; i++) {
+    if (job.fd[i] >= 0 && close(job.fd[i]) != 0 && i == 2) {
+      code = S21_CALC_ERROR;
+    }
+  }
+  return code;
+}
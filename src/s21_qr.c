@@ -0,0 +1,520 @@
+#include <float.h>
+
+#include "s21_internal.h"
+
+// Отражений в одном блоке компактного WY-представления
+#define S21_QR_NB 32
+// Ширина панели, которая раскладывается по одному столбцу
+#define S21_QR_LEAF 8
+// Размер блока строк [A | B] в s21_lstsq: порядка L2, чтобы все проходы
+// по блоку при его разложении шли из кэша
+#define S21_QR_TS_BYTES (1 << 21)
+// Столбцов в одном шаге внутренних циклов панели в s21_lstsq: цикл с
+// постоянной длиной компилятор векторизует
+#define S21_QR_STEP 8
+
+static int min_int(int a, int b) { return a < b ? a : b; }
+
+// Рабочая память QR-разложения матрицы m × n (m >= n). Отражения
+// H(k) = E - tau(k) × v × v^T хранятся под диагональю a (v(k) = 1 не
+// хранится), R - на диагонали и выше.
+typedef struct {
+  int m;
+  int n;
+  double *a;    // m × n, по строкам
+  double *tau;  // n элементов
+  double *v;    // Блок V: (m - k0) × nb, явно, с единицами и нулями
+  double *t;    // Треугольный множитель блока: nb × nb
+  double *w;    // Рабочий блок: nb × max(n, nb)
+} qr_work;
+
+static int qr_alloc(qr_work *q, int m, int n) {
+  int code = S21_OK;
+  int width = n > S21_QR_NB ? n : S21_QR_NB;
+  size_t size = (size_t)m * n + n + (size_t)m * S21_QR_NB +
+                S21_QR_NB * S21_QR_NB + (size_t)S21_QR_NB * width;
+  q->m = m;
+  q->n = n;
+  q->a = (double *)malloc(size * sizeof(double));
+  if (q->a == NULL) {
+    code = S21_ERROR;
+  } else {
+    q->tau = q->a + (size_t)m * n;
+    q->v = q->tau + n;
+    q->t = q->v + (size_t)m * S21_QR_NB;
+    q->w = q->t + S21_QR_NB * S21_QR_NB;
+  }
+  return code;
+}
+
+// Отражение для столбца k, обнуляющее элементы под диагональю; возвращает
+// tau (0 - столбец уже нужного вида)
+static double householder(qr_work *q, int k) {
+  double *a = q->a;
+  int n = q->n;
+  double norm2 = 0;
+  for (int i = k + 1; i < q->m; i++) norm2 += a[i * n + k] * a[i * n + k];
+  double tau = 0;
+  if (norm2 > 0) {
+    double alpha = a[k * n + k];
+    double beta = -copysign(sqrt(alpha * alpha + norm2), alpha);
+    double scale = 1 / (alpha - beta);
+    tau = (beta - alpha) / beta;
+    for (int i = k + 1; i < q->m; i++) a[i * n + k] *= scale;
+    a[k * n + k] = beta;
+  }
+  return tau;
+}
+
+// Треугольный множитель T компактного WY-представления блока из nb
+// отражений: H(0) × … × H(nb - 1) = E - V × T × V^T. g - вне диагонали
+// V^T × V (nb × nb), tau - коэффициенты отражений.
+static void build_t(const double *tau, const double *g, int nb, double *t) {
+  for (int j = 0; j < nb; j++) {
+    // T(0:j, j) = -tau × T(0:j, 0:j) × V(:, 0:j)^T × v(j)
+    for (int i = 0; i < j; i++) {
+      double sum = 0;
+      for (int p = i; p < j; p++) sum += t[i * nb + p] * g[p * nb + j];
+      t[i * nb + j] = -tau[j] * sum;
+    }
+    t[j * nb + j] = tau[j];
+    for (int i = j + 1; i < nb; i++) t[i * nb + j] = 0;
+  }
+}
+
+// w = T × w или, при trans, w = T^T × w на месте (w - nb × cols)
+static void multiply_t(const double *t, int nb, double *w, int cols,
+                       int trans) {
+  if (trans) {
+    for (int i = nb - 1; i >= 0; i--) {
+      double *w_i = w + (size_t)i * cols;
+      for (int j = 0; j < cols; j++) w_i[j] *= t[i * nb + i];
+      for (int p = 0; p < i; p++) {
+        double factor = t[p * nb + i];
+        const double *w_p = w + (size_t)p * cols;
+        for (int j = 0; j < cols; j++) w_i[j] += factor * w_p[j];
+      }
+    }
+  } else {
+    for (int i = 0; i < nb; i++) {
+      double *w_i = w + (size_t)i * cols;
+      for (int j = 0; j < cols; j++) w_i[j] *= t[i * nb + i];
+      for (int p = i + 1; p < nb; p++) {
+        double factor = t[i * nb + p];
+        const double *w_p = w + (size_t)p * cols;
+        for (int j = 0; j < cols; j++) w_i[j] += factor * w_p[j];
+      }
+    }
+  }
+}
+
+// Компактное WY-представление блока отражений [k0, k0 + nb):
+// H(k0) × … × H(k0 + nb - 1) = E - V × T × V^T. V копируется в плотный
+// буфер, T (верхнетреугольная) строится по V^T × V.
+static int build_block(qr_work *q, int k0, int nb) {
+  int rows = q->m - k0;
+  double *v = q->v;
+  for (int r = 0; r < rows; r++) {
+    const double *src = q->a + (size_t)(k0 + r) * q->n + k0;
+    for (int c = 0; c < nb; c++) {
+      v[r * nb + c] = r > c ? src[c] : r == c ? 1.0 : 0.0;
+    }
+  }
+  int code = s21_dgemm(nb, nb, rows, 1.0, v, 1, nb, v, nb, 1, 0.0, q->w, nb);
+  if (code == S21_OK) build_t(q->tau + k0, q->w, nb, q->t);
+  return code;
+}
+
+// C = (E - V × T × V^T) × C или, при trans, (E - V × T^T × V^T) × C для
+// строк [k0, m) матрицы C: два блочных умножения и треугольное умножение
+// nb × cols между ними. c указывает на строку k0.
+static int apply_block(qr_work *q, int k0, int nb, double *c, ptrdiff_t ldc,
+                       int cols, int trans) {
+  int rows = q->m - k0;
+  double *w = q->w;
+  int code = s21_dgemm(nb, cols, rows, 1.0, q->v, 1, nb, c, ldc, 1, 0.0, w,
+                       cols);
+  if (code == S21_OK) {
+    multiply_t(q->t, nb, w, cols, trans);
+    code = s21_dgemm(rows, cols, nb, -1.0, q->v, nb, 1, w, cols, 1, 1.0, c,
+                     ldc);
+  }
+  return code;
+}
+
+// Разложение узкой панели столбцов [k0, k0 + nb) по одному отражению.
+// Отражение применяется к остальным столбцам панели за два прохода по
+// строкам: w = v^T × A, затем A -= tau × v × w.
+static void factor_columns(qr_work *q, int k0, int nb) {
+  double *a = q->a;
+  int n = q->n;
+  double w[S21_QR_NB];
+  for (int k = k0; k < k0 + nb; k++) {
+    double tau = q->tau[k] = householder(q, k);
+    int first = k + 1;
+    int cols = k0 + nb - first;
+    if (tau != 0 && cols > 0) {
+      for (int j = 0; j < cols; j++) w[j] = a[k * n + first + j];
+      for (int i = k + 1; i < q->m; i++) {
+        double v_i = a[i * n + k];
+        const double *row = a + i * n + first;
+        for (int j = 0; j < cols; j++) w[j] += v_i * row[j];
+      }
+      for (int j = 0; j < cols; j++) {
+        w[j] *= tau;
+        a[k * n + first + j] -= w[j];
+      }
+      for (int i = k + 1; i < q->m; i++) {
+        double v_i = a[i * n + k];
+        double *row = a + i * n + first;
+        for (int j = 0; j < cols; j++) row[j] -= v_i * w[j];
+      }
+    }
+  }
+}
+
+// Разложение панели: каждый проход по столбцу читает всю высоту матрицы,
+// поэтому панель делится пополам рекурсивно, и левая половина применяется к
+// правой блочно. Столбцы по одному раскладываются только в узких листьях.
+static int factor_panel(qr_work *q, int k0, int nb) {
+  int code = S21_OK;
+  if (nb <= S21_QR_LEAF) {
+    factor_columns(q, k0, nb);
+  } else {
+    int half = nb / 2;
+    code = factor_panel(q, k0, half);
+    if (code == S21_OK) code = build_block(q, k0, half);
+    if (code == S21_OK) {
+      code = apply_block(q, k0, half, q->a + (size_t)k0 * q->n + k0 + half,
+                         q->n, nb - half, 1);
+    }
+    if (code == S21_OK) code = factor_panel(q, k0 + half, nb - half);
+  }
+  return code;
+}
+
+// Блочное разложение: панель раскладывается по столбцам, затем весь блок
+// отражений применяется к остальным столбцам через s21_dgemm
+static int qr_decompose(qr_work *q) {
+  int code = S21_OK;
+  for (int k0 = 0; k0 < q->n && code == S21_OK; k0 += S21_QR_NB) {
+    int nb = min_int(S21_QR_NB, q->n - k0);
+    code = factor_panel(q, k0, nb);
+    if (code == S21_OK && k0 + nb < q->n) {
+      code = build_block(q, k0, nb);
+      if (code == S21_OK) {
+        code = apply_block(q, k0, nb, q->a + (size_t)k0 * q->n + k0 + nb,
+                           q->n, q->n - k0 - nb, 1);
+      }
+    }
+  }
+  return code;
+}
+
+// Копия A в рабочую память и разложение
+static int qr_start(matrix_t *A, qr_work *q) {
+  int code = qr_alloc(q, A->rows, A->columns);
+  if (code == S21_OK) {
+    memcpy(q->a, A->matrix[0], (size_t)A->rows * A->columns * sizeof(double));
+    code = qr_decompose(q);
+  }
+  if (code != S21_OK) {
+    free(q->a);
+    q->a = NULL;
+  }
+  return code;
+}
+
+static int check_tall(matrix_t *A) {
+  int code = S21_OK;
+  if (A == NULL || A->matrix == NULL || A->rows < 1 || A->columns < 1) {
+    code = S21_ERROR;
+  } else if (A->rows < A->columns) {
+    code = S21_CALC_ERROR;
+  }
+  return code;
+}
+
+int s21_qr(matrix_t *A, matrix_t *Q, matrix_t *R) {
+  int code = check_tall(A);
+  qr_work q = {0};
+  if (code == S21_OK && (Q == NULL || R == NULL)) code = S21_ERROR;
+  if (code == S21_OK) code = qr_start(A, &q);
+  if (code == S21_OK) {
+    int m = q.m;
+    int n = q.n;
+    code = s21_create_matrix(n, n, R);
+    if (code == S21_OK) code = s21_create_matrix(m, n, Q);
+    if (code == S21_OK) {
+      for (int i = 0; i < n; i++) {
+        memcpy(R->matrix[i] + i, q.a + (size_t)i * n + i,
+               (size_t)(n - i) * sizeof(double));
+        Q->matrix[i][i] = 1;
+      }
+      // Q = H(0) × … × H(n - 1) × E(m × n): блоки с конца. Столбцы левее k0
+      // в строках ниже k0 еще нулевые, поэтому блок трогает только правые.
+      int last = (n - 1) / S21_QR_NB * S21_QR_NB;
+      for (int k0 = last; k0 >= 0 && code == S21_OK; k0 -= S21_QR_NB) {
+        int nb = min_int(S21_QR_NB, n - k0);
+        code = build_block(&q, k0, nb);
+        if (code == S21_OK) {
+          code = apply_block(&q, k0, nb, Q->matrix[k0] + k0, n, n - k0, 0);
+        }
+      }
+    }
+    if (code != S21_OK) {
+      s21_remove_matrix(Q);
+      s21_remove_matrix(R);
+    }
+    free(q.a);
+  }
+  return code;
+}
+
+// Разложение для s21_lstsq без копии всей A (TSQR): [A | B] проходит
+// блоками строк. Накопленный треугольник [R | C] (n × width) ставится над
+// очередным блоком, и отражения обнуляют блок под ним. Вектор отражения k -
+// единица в строке k треугольника и плотная часть в столбце k блока, поэтому
+// V отдельно не строится: s21_dgemm читает его прямо из блока. Строки
+// треугольника ниже n не нужны: столбцы A в них нулевые, отражения их не
+// меняют. После последнего блока C - первые n строк Q^T × B.
+typedef struct {
+  int n;          // Столбцов A - отражений на блок
+  int width;      // n + столбцов B
+  int rows;       // Строк в текущем блоке
+  double *r;      // Треугольник [R | C]: n × width
+  double *block;  // Блок строк [A | B]: rows × width
+  double *tau;    // n элементов
+  double *t;      // Треугольный множитель блока: nb × nb
+  double *w;      // Рабочий блок: nb × max(width, nb)
+} tsqr_work;
+
+static int tsqr_alloc(tsqr_work *ts, int n, int width, int block_rows) {
+  int code = S21_OK;
+  int w_width = width > S21_QR_NB ? width : S21_QR_NB;
+  size_t size = ((size_t)n + block_rows) * width + n + S21_QR_NB * S21_QR_NB +
+                (size_t)S21_QR_NB * w_width;
+  ts->n = n;
+  ts->width = width;
+  ts->r = (double *)calloc(size, sizeof(double));
+  if (ts->r == NULL) {
+    code = S21_ERROR;
+  } else {
+    ts->block = ts->r + (size_t)n * width;
+    ts->tau = ts->block + (size_t)block_rows * width;
+    ts->t = ts->tau + n;
+    ts->w = ts->t + S21_QR_NB * S21_QR_NB;
+  }
+  return code;
+}
+
+// Отражение для столбца k по норме его части в блоке norm2: обнуляет
+// столбец k блока, меняя R(k, k)
+static double tsqr_householder(tsqr_work *ts, int k, double norm2) {
+  int width = ts->width;
+  double *v = ts->block + k;
+  double tau = 0;
+  if (norm2 > 0) {
+    double alpha = ts->r[(size_t)k * width + k];
+    double beta = -copysign(sqrt(alpha * alpha + norm2), alpha);
+    double scale = 1 / (alpha - beta);
+    tau = (beta - alpha) / beta;
+    for (int i = 0; i < ts->rows; i++) v[i * width] *= scale;
+    ts->r[(size_t)k * width + k] = beta;
+  }
+  return tau;
+}
+
+// dot(j) += v(c) × a(j) по четырем строкам блока начиная с r0 для всех
+// столбцов панели. Внутренние циклы постоянной длины векторизуются.
+static void panel_dot(const double *r0, int width, int c, int nb,
+                      double *dot) {
+  const double *r1 = r0 + width;
+  const double *r2 = r1 + width;
+  const double *r3 = r2 + width;
+  double s0 = r0[c], s1 = r1[c], s2 = r2[c], s3 = r3[c];
+  int j = 0;
+  for (; j + S21_QR_STEP <= nb; j += S21_QR_STEP) {
+    double *d = dot + j;
+    const double *a0 = r0 + j, *a1 = r1 + j, *a2 = r2 + j, *a3 = r3 + j;
+    for (int q = 0; q < S21_QR_STEP; q++) {
+      d[q] += s0 * a0[q] + s1 * a1[q] + s2 * a2[q] + s3 * a3[q];
+    }
+  }
+  for (; j < nb; j++) {
+    dot[j] += s0 * r0[j] + s1 * r1[j] + s2 * r2[j] + s3 * r3[j];
+  }
+}
+
+// a(j) -= v(c) × dot(j) для столбцов панели правее c в четырех строках;
+// возвращает сумму квадратов обновленного столбца next в них
+static double panel_update(double *r0, int width, int c, int nb,
+                           const double *dot, int next) {
+  double *r1 = r0 + width;
+  double *r2 = r1 + width;
+  double *r3 = r2 + width;
+  double s0 = r0[c], s1 = r1[c], s2 = r2[c], s3 = r3[c];
+  int j = c + 1;
+  for (; j < nb && j % S21_QR_STEP != 0; j++) {
+    r0[j] -= s0 * dot[j];
+    r1[j] -= s1 * dot[j];
+    r2[j] -= s2 * dot[j];
+    r3[j] -= s3 * dot[j];
+  }
+  for (; j + S21_QR_STEP <= nb; j += S21_QR_STEP) {
+    const double *d = dot + j;
+    double *a0 = r0 + j, *a1 = r1 + j, *a2 = r2 + j, *a3 = r3 + j;
+    for (int q = 0; q < S21_QR_STEP; q++) a0[q] -= s0 * d[q];
+    for (int q = 0; q < S21_QR_STEP; q++) a1[q] -= s1 * d[q];
+    for (int q = 0; q < S21_QR_STEP; q++) a2[q] -= s2 * d[q];
+    for (int q = 0; q < S21_QR_STEP; q++) a3[q] -= s3 * d[q];
+  }
+  for (; j < nb; j++) {
+    r0[j] -= s0 * dot[j];
+    r1[j] -= s1 * dot[j];
+    r2[j] -= s2 * dot[j];
+    r3[j] -= s3 * dot[j];
+  }
+  return r0[next] * r0[next] + r1[next] * r1[next] + r2[next] * r2[next] +
+         r3[next] * r3[next];
+}
+
+// Панель [k0, k0 + nb) по одному отражению и ее множитель T. Один проход
+// по строкам блока для отражения k дает сразу v(k)^T × v(j) для левых
+// столбцов панели (столбец k матрицы V^T × V для T) и v(k)^T × A для
+// правых; второй проход обновляет правые столбцы и заодно считает норму
+// следующего столбца. Строки идут по четыре (блок дополнен нулевыми
+// строками), чтобы dot читался и записывался реже строк блока.
+static void tsqr_factor_panel(tsqr_work *ts, int k0, int nb) {
+  int width = ts->width;
+  double *base = ts->block + k0;
+  double *g = ts->w;  // V^T × V панели, nb × nb
+  double dot[S21_QR_NB];
+  double norm2 = 0;
+  for (int i = 0; i < ts->rows; i++) {
+    norm2 += base[(size_t)i * width] * base[(size_t)i * width];
+  }
+  for (int c = 0; c < nb; c++) {
+    int k = k0 + c;
+    double tau = ts->tau[k] = tsqr_householder(ts, k, norm2);
+    double *r_k = ts->r + (size_t)k * width + k0;
+    memset(dot, 0, sizeof(dot));
+    for (int i = 0; i < ts->rows; i += 4) {
+      panel_dot(base + (size_t)i * width, width, c, nb, dot);
+    }
+    for (int j = 0; j < c; j++) g[j * nb + c] = dot[j];
+    for (int j = c + 1; j < nb; j++) {
+      dot[j] = tau * (dot[j] + r_k[j]);
+      r_k[j] -= dot[j];
+    }
+    // После последнего столбца норма не нужна
+    int next = c + 1 < nb ? c + 1 : c;
+    norm2 = 0;
+    for (int i = 0; i < ts->rows; i += 4) {
+      norm2 += panel_update(base + (size_t)i * width, width, c, nb, dot, next);
+    }
+  }
+  build_t(ts->tau + k0, g, nb, ts->t);
+}
+
+// Столбцы [c0, c0 + cols) треугольника и блока умножаются на
+// E - V × T^T × V^T отражений [k0, k0 + nb): из треугольника участвуют
+// только строки [k0, k0 + nb)
+static int tsqr_apply_block(tsqr_work *ts, int k0, int nb, int c0, int cols) {
+  int width = ts->width;
+  const double *v = ts->block + k0;
+  double *r = ts->r + (size_t)k0 * width + c0;
+  double *w = ts->w;
+  for (int i = 0; i < nb; i++) {
+    memcpy(w + (size_t)i * cols, r + (size_t)i * width,
+           (size_t)cols * sizeof(double));
+  }
+  int code = s21_dgemm(nb, cols, ts->rows, 1.0, v, 1, width, ts->block + c0,
+                       width, 1, 1.0, w, cols);
+  if (code == S21_OK) {
+    multiply_t(ts->t, nb, w, cols, 1);
+    for (int i = 0; i < nb; i++) {
+      s21_vec_sub(r + (size_t)i * width, w + (size_t)i * cols,
+                  r + (size_t)i * width, (size_t)cols);
+    }
+    code = s21_dgemm(ts->rows, cols, nb, -1.0, v, width, 1, w, cols, 1, 1.0,
+                     ts->block + c0, width);
+  }
+  return code;
+}
+
+// Обнуление текущего блока: панели по S21_QR_NB отражений, каждая
+// применяется к остальным столбцам A и к столбцам B
+static int tsqr_factor_block(tsqr_work *ts) {
+  int code = S21_OK;
+  for (int k0 = 0; k0 < ts->n && code == S21_OK; k0 += S21_QR_NB) {
+    int nb = min_int(S21_QR_NB, ts->n - k0);
+    tsqr_factor_panel(ts, k0, nb);
+    code = tsqr_apply_block(ts, k0, nb, k0 + nb, ts->width - k0 - nb);
+  }
+  return code;
+}
+
+int s21_lstsq(matrix_t *A, matrix_t *B, matrix_t *X) {
+  int code = check_tall(A);
+  tsqr_work ts = {0};
+  if (code == S21_OK &&
+      (B == NULL || B->matrix == NULL || B->columns < 1 || X == NULL)) {
+    code = S21_ERROR;
+  } else if (code == S21_OK && B->rows != A->rows) {
+    code = S21_CALC_ERROR;
+  }
+  int m = code == S21_OK ? A->rows : 0;
+  int n = code == S21_OK ? A->columns : 0;
+  int nrhs = code == S21_OK ? B->columns : 0;
+  int width = n + nrhs;
+  int block_rows = 0;
+  if (code == S21_OK) {
+    block_rows = (int)(S21_QR_TS_BYTES / ((size_t)width * sizeof(double)));
+    block_rows = min_int(m, block_rows > S21_QR_NB ? block_rows : S21_QR_NB);
+    // Панель идет по четыре строки; нулевые строки на разложение не влияют
+    block_rows = (block_rows + 3) / 4 * 4;
+    code = tsqr_alloc(&ts, n, width, block_rows);
+  }
+  for (int s = 0; s < m && code == S21_OK; s += block_rows) {
+    int count = min_int(block_rows, m - s);
+    ts.rows = (count + 3) / 4 * 4;
+    for (int i = 0; i < count; i++) {
+      double *row = ts.block + (size_t)i * width;
+      memcpy(row, A->matrix[s + i], (size_t)n * sizeof(double));
+      memcpy(row + n, B->matrix[s + i], (size_t)nrhs * sizeof(double));
+    }
+    memset(ts.block + (size_t)count * width, 0,
+           (size_t)(ts.rows - count) * width * sizeof(double));
+    code = tsqr_factor_block(&ts);
+  }
+  if (code == S21_OK) {
+    // Ранг неполный, если диагональ R мала по сравнению с ее максимумом
+    double max_diagonal = 0;
+    for (int i = 0; i < n; i++) {
+      max_diagonal = fmax(max_diagonal, fabs(ts.r[(size_t)i * width + i]));
+    }
+    double tolerance = m * DBL_EPSILON * max_diagonal;
+    for (int i = 0; i < n && code == S21_OK; i++) {
+      if (!(fabs(ts.r[(size_t)i * width + i]) > tolerance)) {
+        code = S21_CALC_ERROR;
+      }
+    }
+  }
+  if (code == S21_OK) code = s21_create_matrix(n, nrhs, X);
+  if (code == S21_OK) {
+    // R × X = C
+    for (int i = n - 1; i >= 0; i--) {
+      const double *r_i = ts.r + (size_t)i * width;
+      double *x_i = X->matrix[i];
+      memcpy(x_i, r_i + n, (size_t)nrhs * sizeof(double));
+      for (int j = i + 1; j < n; j++) {
+        const double *x_j = X->matrix[j];
+        for (int k = 0; k < nrhs; k++) x_i[k] -= r_i[j] * x_j[k];
+      }
+      for (int k = 0; k < nrhs; k++) x_i[k] /= r_i[i];
+    }
+  }
+  free(ts.r);
+  return code;
+}
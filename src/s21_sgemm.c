@@ -0,0 +1,61 @@
+#include "s21_internal.h"
+
+// Блочное умножение для float (тот же шаблон, что и s21_dgemm): в регистр
+// помещается вдвое больше элементов, поэтому микропанель B шире - 4 × 16
+#define S21_GEMM_T float
+#define S21_GEMM_NR 16
+#define S21_GEMM_FUNC s21_sgemm
+#define S21_GEMM_WS_FUNC s21_sgemm_ws
+#define S21_GEMM_WS_SIZE s21_sgemm_ws_size
+#include "s21_gemm_impl.h"
+
+// Глубина куска A и B, расширяемого до double за один шаг
+#define S21_SGEMM_WIDE_KC 256
+
+// Расширение блока rows × cols (элемент (i, j) по адресу
+// src[i * rs + j * cs]) в плотный блок double по строкам
+static void widen(int rows, int cols, const float *src, ptrdiff_t rs,
+                  ptrdiff_t cs, double *dst) {
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) *dst++ = src[i * rs + j * cs];
+  }
+}
+
+int s21_sgemm_wide(int m, int n, int k, float alpha, const float *a,
+                   ptrdiff_t rsa, ptrdiff_t csa, const float *b,
+                   ptrdiff_t rsb, ptrdiff_t csb, float beta, float *c,
+                   ptrdiff_t ldc) {
+  int code = S21_OK;
+  int kc_max = min_int(k, S21_SGEMM_WIDE_KC);
+  size_t c_size = (size_t)m * n;
+  size_t panels = ((size_t)m + (size_t)n) * kc_max;
+  double *acc = (double *)malloc((c_size + panels) * sizeof(double));
+  if (acc == NULL) {
+    code = S21_ERROR;
+  } else {
+    double *a_wide = acc + c_size;
+    double *b_wide = a_wide + (size_t)m * kc_max;
+    for (int i = 0; i < m; i++) {
+      for (int j = 0; j < n; j++) {
+        acc[(size_t)i * n + j] =
+            beta == 0.0f ? 0.0 : (double)beta * c[i * ldc + j];
+      }
+    }
+    // Куски A и B по глубине расширяются до double и накапливаются в acc
+    // блочным s21_dgemm; в float округляется только итоговая сумма
+    for (int pc = 0; pc < k && code == S21_OK; pc += S21_SGEMM_WIDE_KC) {
+      int kc = min_int(S21_SGEMM_WIDE_KC, k - pc);
+      widen(m, kc, a + pc * csa, rsa, csa, a_wide);
+      widen(kc, n, b + pc * rsb, rsb, csb, b_wide);
+      code = s21_dgemm(m, n, kc, alpha, a_wide, kc, 1, b_wide, n, 1, 1.0, acc,
+                       n);
+    }
+    for (int i = 0; i < m && code == S21_OK; i++) {
+      for (int j = 0; j < n; j++) {
+        c[i * ldc + j] = (float)acc[(size_t)i * n + j];
+      }
+    }
+    free(acc);
+  }
+  return code;
+}
@@ -0,0 +1,657 @@
+#include "s21_internal.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define S21_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+// Скалярные ядра - работают везде и служат запасным вариантом
+
+static void add_scalar(const double *a, const double *b, double *c, size_t n) {
+  for (size_t i = 0; i < n; i++) c[i] = a[i] + b[i];
+}
+
+static void sub_scalar(const double *a, const double *b, double *c, size_t n) {
+  for (size_t i = 0; i < n; i++) c[i] = a[i] - b[i];
+}
+
+static void scale_scalar(const double *a, double k, double *c, size_t n) {
+  for (size_t i = 0; i < n; i++) c[i] = a[i] * k;
+}
+
+static int eq_scalar(const double *a, const double *b, size_t n, double eps) {
+  int code = SUCCESS;
+  for (size_t i = 0; i < n && code == SUCCESS; i++) {
+    if (fabs(a[i] - b[i]) > eps) code = FAILURE;
+  }
+  return code;
+}
+
+static void transpose_scalar(const double *a, ptrdiff_t lda, double *b,
+                             ptrdiff_t ldb, int rows, int cols) {
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) b[j * ldb + i] = a[i * lda + j];
+  }
+}
+
+// Те же ядра для float
+
+static void add_f32_scalar(const float *a, const float *b, float *c,
+                           size_t n) {
+  for (size_t i = 0; i < n; i++) c[i] = a[i] + b[i];
+}
+
+static void sub_f32_scalar(const float *a, const float *b, float *c,
+                           size_t n) {
+  for (size_t i = 0; i < n; i++) c[i] = a[i] - b[i];
+}
+
+static void scale_f32_scalar(const float *a, float k, float *c, size_t n) {
+  for (size_t i = 0; i < n; i++) c[i] = a[i] * k;
+}
+
+static int eq_f32_scalar(const float *a, const float *b, size_t n,
+                         float eps) {
+  int code = SUCCESS;
+  for (size_t i = 0; i < n && code == SUCCESS; i++) {
+    if (fabsf(a[i] - b[i]) > eps) code = FAILURE;
+  }
+  return code;
+}
+
+static void transpose_f32_scalar(const float *a, ptrdiff_t lda, float *b,
+                                 ptrdiff_t ldb, int rows, int cols) {
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) b[j * ldb + i] = a[i * lda + j];
+  }
+}
+
+#ifdef S21_SIMD_X86
+
+// SSE2: по 2 double за инструкцию
+
+__attribute__((target("sse2"))) static void add_sse2(const double *a,
+                                                      const double *b,
+                                                      double *c, size_t n) {
+  size_t i = 0;
+  for (; i + 2 <= n; i += 2) {
+    _mm_storeu_pd(c + i, _mm_add_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+  }
+  add_scalar(a + i, b + i, c + i, n - i);
+}
+
+__attribute__((target("sse2"))) static void sub_sse2(const double *a,
+                                                      const double *b,
+                                                      double *c, size_t n) {
+  size_t i = 0;
+  for (; i + 2 <= n; i += 2) {
+    _mm_storeu_pd(c + i, _mm_sub_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+  }
+  sub_scalar(a + i, b + i, c + i, n - i);
+}
+
+__attribute__((target("sse2"))) static void scale_sse2(const double *a,
+                                                        double k, double *c,
+                                                        size_t n) {
+  __m128d factor = _mm_set1_pd(k);
+  size_t i = 0;
+  for (; i + 2 <= n; i += 2) {
+    _mm_storeu_pd(c + i, _mm_mul_pd(_mm_loadu_pd(a + i), factor));
+  }
+  scale_scalar(a + i, k, c + i, n - i);
+}
+
+__attribute__((target("sse2"))) static int eq_sse2(const double *a,
+                                                    const double *b, size_t n,
+                                                    double eps) {
+  __m128d sign = _mm_set1_pd(-0.0);
+  __m128d limit = _mm_set1_pd(eps);
+  int differ = 0;
+  size_t i = 0;
+  for (; i + 2 <= n && !differ; i += 2) {
+    __m128d diff = _mm_sub_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i));
+    differ = _mm_movemask_pd(_mm_cmpgt_pd(_mm_andnot_pd(sign, diff), limit));
+  }
+  return differ ? FAILURE : eq_scalar(a + i, b + i, n - i, eps);
+}
+
+// Транспонирование плитками 2 × 2 в регистрах, края - скалярно
+__attribute__((target("sse2"))) static void transpose_sse2(const double *a,
+                                                            ptrdiff_t lda,
+                                                            double *b,
+                                                            ptrdiff_t ldb,
+                                                            int rows,
+                                                            int cols) {
+  int i = 0;
+  for (; i + 2 <= rows; i += 2) {
+    const double *src = a + i * lda;
+    int j = 0;
+    for (; j + 2 <= cols; j += 2) {
+      __m128d r0 = _mm_loadu_pd(src + j);
+      __m128d r1 = _mm_loadu_pd(src + lda + j);
+      _mm_storeu_pd(b + j * ldb + i, _mm_unpacklo_pd(r0, r1));
+      _mm_storeu_pd(b + (j + 1) * ldb + i, _mm_unpackhi_pd(r0, r1));
+    }
+    transpose_scalar(src + j, lda, b + j * ldb + i, ldb, 2, cols - j);
+  }
+  transpose_scalar(a + i * lda, lda, b + i, ldb, rows - i, cols);
+}
+
+// SSE2 для float: по 4 float за инструкцию
+
+__attribute__((target("sse2"))) static void add_f32_sse2(const float *a,
+                                                          const float *b,
+                                                          float *c, size_t n) {
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    _mm_storeu_ps(c + i, _mm_add_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+  }
+  add_f32_scalar(a + i, b + i, c + i, n - i);
+}
+
+__attribute__((target("sse2"))) static void sub_f32_sse2(const float *a,
+                                                          const float *b,
+                                                          float *c, size_t n) {
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    _mm_storeu_ps(c + i, _mm_sub_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+  }
+  sub_f32_scalar(a + i, b + i, c + i, n - i);
+}
+
+__attribute__((target("sse2"))) static void scale_f32_sse2(const float *a,
+                                                            float k, float *c,
+                                                            size_t n) {
+  __m128 factor = _mm_set1_ps(k);
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    _mm_storeu_ps(c + i, _mm_mul_ps(_mm_loadu_ps(a + i), factor));
+  }
+  scale_f32_scalar(a + i, k, c + i, n - i);
+}
+
+__attribute__((target("sse2"))) static int eq_f32_sse2(const float *a,
+                                                        const float *b,
+                                                        size_t n, float eps) {
+  __m128 sign = _mm_set1_ps(-0.0f);
+  __m128 limit = _mm_set1_ps(eps);
+  int differ = 0;
+  size_t i = 0;
+  for (; i + 4 <= n && !differ; i += 4) {
+    __m128 diff = _mm_sub_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i));
+    differ = _mm_movemask_ps(_mm_cmpgt_ps(_mm_andnot_ps(sign, diff), limit));
+  }
+  return differ ? FAILURE : eq_f32_scalar(a + i, b + i, n - i, eps);
+}
+
+// Плитка 4 × 4 float
+__attribute__((target("sse2"))) static void transpose_f32_sse2(
+    const float *a, ptrdiff_t lda, float *b, ptrdiff_t ldb, int rows,
+    int cols) {
+  int i = 0;
+  for (; i + 4 <= rows; i += 4) {
+    const float *src = a + i * lda;
+    int j = 0;
+    for (; j + 4 <= cols; j += 4) {
+      __m128 r0 = _mm_loadu_ps(src + j);
+      __m128 r1 = _mm_loadu_ps(src + lda + j);
+      __m128 r2 = _mm_loadu_ps(src + 2 * lda + j);
+      __m128 r3 = _mm_loadu_ps(src + 3 * lda + j);
+      _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+      float *dst = b + j * ldb + i;
+      _mm_storeu_ps(dst, r0);
+      _mm_storeu_ps(dst + ldb, r1);
+      _mm_storeu_ps(dst + 2 * ldb, r2);
+      _mm_storeu_ps(dst + 3 * ldb, r3);
+    }
+    transpose_f32_scalar(src + j, lda, b + j * ldb + i, ldb, 4, cols - j);
+  }
+  transpose_f32_scalar(a + i * lda, lda, b + i, ldb, rows - i, cols);
+}
+
+// AVX2: по 4 double за инструкцию
+
+__attribute__((target("avx2"))) static void add_avx2(const double *a,
+                                                      const double *b,
+                                                      double *c, size_t n) {
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    _mm256_storeu_pd(c + i, _mm256_add_pd(_mm256_loadu_pd(a + i),
+                                          _mm256_loadu_pd(b + i)));
+  }
+  add_scalar(a + i, b + i, c + i, n - i);
+}
+
+__attribute__((target("avx2"))) static void sub_avx2(const double *a,
+                                                      const double *b,
+                                                      double *c, size_t n) {
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    _mm256_storeu_pd(c + i, _mm256_sub_pd(_mm256_loadu_pd(a + i),
+                                          _mm256_loadu_pd(b + i)));
+  }
+  sub_scalar(a + i, b + i, c + i, n - i);
+}
+
+__attribute__((target("avx2"))) static void scale_avx2(const double *a,
+                                                        double k, double *c,
+                                                        size_t n) {
+  __m256d factor = _mm256_set1_pd(k);
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    _mm256_storeu_pd(c + i, _mm256_mul_pd(_mm256_loadu_pd(a + i), factor));
+  }
+  scale_scalar(a + i, k, c + i, n - i);
+}
+
+__attribute__((target("avx2"))) static int eq_avx2(const double *a,
+                                                    const double *b, size_t n,
+                                                    double eps) {
+  __m256d sign = _mm256_set1_pd(-0.0);
+  __m256d limit = _mm256_set1_pd(eps);
+  int differ = 0;
+  size_t i = 0;
+  for (; i + 4 <= n && !differ; i += 4) {
+    __m256d diff =
+        _mm256_sub_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i));
+    differ = _mm256_movemask_pd(
+        _mm256_cmp_pd(_mm256_andnot_pd(sign, diff), limit, _CMP_GT_OQ));
+  }
+  return differ ? FAILURE : eq_scalar(a + i, b + i, n - i, eps);
+}
+
+// Плитка 4 × 4: попарное чередование строк, затем обмен 128-битными
+// половинами
+__attribute__((target("avx2"))) static void transpose_avx2(const double *a,
+                                                            ptrdiff_t lda,
+                                                            double *b,
+                                                            ptrdiff_t ldb,
+                                                            int rows,
+                                                            int cols) {
+  int i = 0;
+  for (; i + 4 <= rows; i += 4) {
+    const double *src = a + i * lda;
+    int j = 0;
+    for (; j + 4 <= cols; j += 4) {
+      __m256d r0 = _mm256_loadu_pd(src + j);
+      __m256d r1 = _mm256_loadu_pd(src + lda + j);
+      __m256d r2 = _mm256_loadu_pd(src + 2 * lda + j);
+      __m256d r3 = _mm256_loadu_pd(src + 3 * lda + j);
+      __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+      __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+      __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+      __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+      double *dst = b + j * ldb + i;
+      _mm256_storeu_pd(dst, _mm256_permute2f128_pd(t0, t2, 0x20));
+      _mm256_storeu_pd(dst + ldb, _mm256_permute2f128_pd(t1, t3, 0x20));
+      _mm256_storeu_pd(dst + 2 * ldb, _mm256_permute2f128_pd(t0, t2, 0x31));
+      _mm256_storeu_pd(dst + 3 * ldb, _mm256_permute2f128_pd(t1, t3, 0x31));
+    }
+    transpose_scalar(src + j, lda, b + j * ldb + i, ldb, 4, cols - j);
+  }
+  transpose_scalar(a + i * lda, lda, b + i, ldb, rows - i, cols);
+}
+
+// AVX2 для float: по 8 float за инструкцию
+
+__attribute__((target("avx2"))) static void add_f32_avx2(const float *a,
+                                                          const float *b,
+                                                          float *c, size_t n) {
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm256_storeu_ps(c + i, _mm256_add_ps(_mm256_loadu_ps(a + i),
+                                          _mm256_loadu_ps(b + i)));
+  }
+  add_f32_scalar(a + i, b + i, c + i, n - i);
+}
+
+__attribute__((target("avx2"))) static void sub_f32_avx2(const float *a,
+                                                          const float *b,
+                                                          float *c, size_t n) {
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm256_storeu_ps(c + i, _mm256_sub_ps(_mm256_loadu_ps(a + i),
+                                          _mm256_loadu_ps(b + i)));
+  }
+  sub_f32_scalar(a + i, b + i, c + i, n - i);
+}
+
+__attribute__((target("avx2"))) static void scale_f32_avx2(const float *a,
+                                                            float k, float *c,
+                                                            size_t n) {
+  __m256 factor = _mm256_set1_ps(k);
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm256_storeu_ps(c + i, _mm256_mul_ps(_mm256_loadu_ps(a + i), factor));
+  }
+  scale_f32_scalar(a + i, k, c + i, n - i);
+}
+
+__attribute__((target("avx2"))) static int eq_f32_avx2(const float *a,
+                                                        const float *b,
+                                                        size_t n, float eps) {
+  __m256 sign = _mm256_set1_ps(-0.0f);
+  __m256 limit = _mm256_set1_ps(eps);
+  int differ = 0;
+  size_t i = 0;
+  for (; i + 8 <= n && !differ; i += 8) {
+    __m256 diff = _mm256_sub_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i));
+    differ = _mm256_movemask_ps(
+        _mm256_cmp_ps(_mm256_andnot_ps(sign, diff), limit, _CMP_GT_OQ));
+  }
+  return differ ? FAILURE : eq_f32_scalar(a + i, b + i, n - i, eps);
+}
+
+// Плитка 8 × 8 float: чередование пар строк, сборка четверок внутри
+// 128-битных половин и обмен половинами
+__attribute__((target("avx2"))) static void transpose_f32_avx2(
+    const float *a, ptrdiff_t lda, float *b, ptrdiff_t ldb, int rows,
+    int cols) {
+  int i = 0;
+  for (; i + 8 <= rows; i += 8) {
+    const float *src = a + i * lda;
+    int j = 0;
+    for (; j + 8 <= cols; j += 8) {
+      __m256 t[8], s[8];
+      for (int r = 0; r < 8; r += 2) {
+        __m256 r0 = _mm256_loadu_ps(src + r * lda + j);
+        __m256 r1 = _mm256_loadu_ps(src + (r + 1) * lda + j);
+        t[r] = _mm256_unpacklo_ps(r0, r1);
+        t[r + 1] = _mm256_unpackhi_ps(r0, r1);
+      }
+      // s[q] - столбцы q и q + 4 строк 0-3 плитки, s[q + 4] - строк 4-7
+      for (int h = 0; h < 8; h += 4) {
+        s[h] = _mm256_shuffle_ps(t[h], t[h + 2], 0x44);
+        s[h + 1] = _mm256_shuffle_ps(t[h], t[h + 2], 0xEE);
+        s[h + 2] = _mm256_shuffle_ps(t[h + 1], t[h + 3], 0x44);
+        s[h + 3] = _mm256_shuffle_ps(t[h + 1], t[h + 3], 0xEE);
+      }
+      float *dst = b + j * ldb + i;
+      for (int q = 0; q < 4; q++) {
+        _mm256_storeu_ps(dst + q * ldb,
+                         _mm256_permute2f128_ps(s[q], s[q + 4], 0x20));
+        _mm256_storeu_ps(dst + (q + 4) * ldb,
+                         _mm256_permute2f128_ps(s[q], s[q + 4], 0x31));
+      }
+    }
+    transpose_f32_scalar(src + j, lda, b + j * ldb + i, ldb, 8, cols - j);
+  }
+  transpose_f32_scalar(a + i * lda, lda, b + i, ldb, rows - i, cols);
+}
+
+// AVX-512: по 8 double за инструкцию, хвост обрабатывается маской
+
+__attribute__((target("avx512f"))) static void add_avx512(const double *a,
+                                                          const double *b,
+                                                          double *c, size_t n) {
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm512_storeu_pd(c + i, _mm512_add_pd(_mm512_loadu_pd(a + i),
+                                          _mm512_loadu_pd(b + i)));
+  }
+  __mmask8 tail = (__mmask8)((1u << (n - i)) - 1);
+  _mm512_mask_storeu_pd(c + i, tail,
+                        _mm512_add_pd(_mm512_maskz_loadu_pd(tail, a + i),
+                                      _mm512_maskz_loadu_pd(tail, b + i)));
+}
+
+__attribute__((target("avx512f"))) static void sub_avx512(const double *a,
+                                                          const double *b,
+                                                          double *c, size_t n) {
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm512_storeu_pd(c + i, _mm512_sub_pd(_mm512_loadu_pd(a + i),
+                                          _mm512_loadu_pd(b + i)));
+  }
+  __mmask8 tail = (__mmask8)((1u << (n - i)) - 1);
+  _mm512_mask_storeu_pd(c + i, tail,
+                        _mm512_sub_pd(_mm512_maskz_loadu_pd(tail, a + i),
+                                      _mm512_maskz_loadu_pd(tail, b + i)));
+}
+
+__attribute__((target("avx512f"))) static void scale_avx512(const double *a,
+                                                            double k,
+                                                            double *c,
+                                                            size_t n) {
+  __m512d factor = _mm512_set1_pd(k);
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm512_storeu_pd(c + i, _mm512_mul_pd(_mm512_loadu_pd(a + i), factor));
+  }
+  __mmask8 tail = (__mmask8)((1u << (n - i)) - 1);
+  _mm512_mask_storeu_pd(
+      c + i, tail, _mm512_mul_pd(_mm512_maskz_loadu_pd(tail, a + i), factor));
+}
+
+__attribute__((target("avx512f"))) static int eq_avx512(const double *a,
+                                                        const double *b,
+                                                        size_t n, double eps) {
+  __m512d limit = _mm512_set1_pd(eps);
+  __mmask8 differ = 0;
+  size_t i = 0;
+  for (; i + 8 <= n && !differ; i += 8) {
+    __m512d diff =
+        _mm512_sub_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i));
+    differ = _mm512_cmp_pd_mask(_mm512_abs_pd(diff), limit, _CMP_GT_OQ);
+  }
+  if (!differ) {
+    __mmask8 tail = (__mmask8)((1u << (n - i)) - 1);
+    __m512d diff = _mm512_sub_pd(_mm512_maskz_loadu_pd(tail, a + i),
+                                 _mm512_maskz_loadu_pd(tail, b + i));
+    differ = _mm512_mask_cmp_pd_mask(tail, _mm512_abs_pd(diff), limit,
+                                     _CMP_GT_OQ);
+  }
+  return differ ? FAILURE : SUCCESS;
+}
+
+// Плитка 8 × 8 в три шага: чередование пар строк, сборка четверок строк
+// и объединение 256-битных половин
+__attribute__((target("avx512f"))) static void transpose_avx512(
+    const double *a, ptrdiff_t lda, double *b, ptrdiff_t ldb, int rows,
+    int cols) {
+  const __m512i pairs_lo = _mm512_set_epi64(13, 12, 5, 4, 9, 8, 1, 0);
+  const __m512i pairs_hi = _mm512_set_epi64(15, 14, 7, 6, 11, 10, 3, 2);
+  const __m512i halves_lo = _mm512_set_epi64(11, 10, 9, 8, 3, 2, 1, 0);
+  const __m512i halves_hi = _mm512_set_epi64(15, 14, 13, 12, 7, 6, 5, 4);
+  int i = 0;
+  for (; i + 8 <= rows; i += 8) {
+    const double *src = a + i * lda;
+    int j = 0;
+    for (; j + 8 <= cols; j += 8) {
+      __m512d t[8], s[8];
+      for (int r = 0; r < 8; r += 2) {
+        __m512d r0 = _mm512_loadu_pd(src + r * lda + j);
+        __m512d r1 = _mm512_loadu_pd(src + (r + 1) * lda + j);
+        t[r] = _mm512_unpacklo_pd(r0, r1);
+        t[r + 1] = _mm512_unpackhi_pd(r0, r1);
+      }
+      // s[q] - столбцы q и q + 4 строк 0-3 плитки, s[q + 4] - строк 4-7
+      for (int h = 0; h < 8; h += 4) {
+        s[h] = _mm512_permutex2var_pd(t[h], pairs_lo, t[h + 2]);
+        s[h + 1] = _mm512_permutex2var_pd(t[h + 1], pairs_lo, t[h + 3]);
+        s[h + 2] = _mm512_permutex2var_pd(t[h], pairs_hi, t[h + 2]);
+        s[h + 3] = _mm512_permutex2var_pd(t[h + 1], pairs_hi, t[h + 3]);
+      }
+      double *dst = b + j * ldb + i;
+      for (int q = 0; q < 4; q++) {
+        _mm512_storeu_pd(dst + q * ldb,
+                         _mm512_permutex2var_pd(s[q], halves_lo, s[q + 4]));
+        _mm512_storeu_pd(dst + (q + 4) * ldb,
+                         _mm512_permutex2var_pd(s[q], halves_hi, s[q + 4]));
+      }
+    }
+    transpose_scalar(src + j, lda, b + j * ldb + i, ldb, 8, cols - j);
+  }
+  transpose_scalar(a + i * lda, lda, b + i, ldb, rows - i, cols);
+}
+
+// AVX-512 для float: по 16 float за инструкцию, хвост - маской
+
+__attribute__((target("avx512f"))) static void add_f32_avx512(const float *a,
+                                                              const float *b,
+                                                              float *c,
+                                                              size_t n) {
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    _mm512_storeu_ps(c + i, _mm512_add_ps(_mm512_loadu_ps(a + i),
+                                          _mm512_loadu_ps(b + i)));
+  }
+  __mmask16 tail = (__mmask16)((1u << (n - i)) - 1);
+  _mm512_mask_storeu_ps(c + i, tail,
+                        _mm512_add_ps(_mm512_maskz_loadu_ps(tail, a + i),
+                                      _mm512_maskz_loadu_ps(tail, b + i)));
+}
+
+__attribute__((target("avx512f"))) static void sub_f32_avx512(const float *a,
+                                                              const float *b,
+                                                              float *c,
+                                                              size_t n) {
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    _mm512_storeu_ps(c + i, _mm512_sub_ps(_mm512_loadu_ps(a + i),
+                                          _mm512_loadu_ps(b + i)));
+  }
+  __mmask16 tail = (__mmask16)((1u << (n - i)) - 1);
+  _mm512_mask_storeu_ps(c + i, tail,
+                        _mm512_sub_ps(_mm512_maskz_loadu_ps(tail, a + i),
+                                      _mm512_maskz_loadu_ps(tail, b + i)));
+}
+
+__attribute__((target("avx512f"))) static void scale_f32_avx512(const float *a,
+                                                                float k,
+                                                                float *c,
+                                                                size_t n) {
+  __m512 factor = _mm512_set1_ps(k);
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    _mm512_storeu_ps(c + i, _mm512_mul_ps(_mm512_loadu_ps(a + i), factor));
+  }
+  __mmask16 tail = (__mmask16)((1u << (n - i)) - 1);
+  _mm512_mask_storeu_ps(
+      c + i, tail, _mm512_mul_ps(_mm512_maskz_loadu_ps(tail, a + i), factor));
+}
+
+__attribute__((target("avx512f"))) static int eq_f32_avx512(const float *a,
+                                                            const float *b,
+                                                            size_t n,
+                                                            float eps) {
+  __m512 limit = _mm512_set1_ps(eps);
+  __mmask16 differ = 0;
+  size_t i = 0;
+  for (; i + 16 <= n && !differ; i += 16) {
+    __m512 diff = _mm512_sub_ps(_mm512_loadu_ps(a + i), _mm512_loadu_ps(b + i));
+    differ = _mm512_cmp_ps_mask(_mm512_abs_ps(diff), limit, _CMP_GT_OQ);
+  }
+  if (!differ) {
+    __mmask16 tail = (__mmask16)((1u << (n - i)) - 1);
+    __m512 diff = _mm512_sub_ps(_mm512_maskz_loadu_ps(tail, a + i),
+                                _mm512_maskz_loadu_ps(tail, b + i));
+    differ = _mm512_mask_cmp_ps_mask(tail, _mm512_abs_ps(diff), limit,
+                                     _CMP_GT_OQ);
+  }
+  return differ ? FAILURE : SUCCESS;
+}
+
+#endif  // S21_SIMD_X86
+
+// Таблица ядер по уровням S21_SIMD_*
+typedef struct {
+  void (*add)(const double *a, const double *b, double *c, size_t n);
+  void (*sub)(const double *a, const double *b, double *c, size_t n);
+  void (*scale)(const double *a, double k, double *c, size_t n);
+  int (*eq)(const double *a, const double *b, size_t n, double eps);
+  void (*transpose)(const double *a, ptrdiff_t lda, double *b, ptrdiff_t ldb,
+                    int rows, int cols);
+  void (*add_f32)(const float *a, const float *b, float *c, size_t n);
+  void (*sub_f32)(const float *a, const float *b, float *c, size_t n);
+  void (*scale_f32)(const float *a, float k, float *c, size_t n);
+  int (*eq_f32)(const float *a, const float *b, size_t n, float eps);
+  void (*transpose_f32)(const float *a, ptrdiff_t lda, float *b,
+                        ptrdiff_t ldb, int rows, int cols);
+} s21_vec_kernels;
+
+// Для транспонирования float на уровне AVX-512 берется ядро AVX2: плитка
+// 8 × 8 float целиком помещается в 256-битные регистры
+static const s21_vec_kernels kernels[] = {
+    {add_scalar, sub_scalar, scale_scalar, eq_scalar, transpose_scalar,
+     add_f32_scalar, sub_f32_scalar, scale_f32_scalar, eq_f32_scalar,
+     transpose_f32_scalar},
+#ifdef S21_SIMD_X86
+    {add_sse2, sub_sse2, scale_sse2, eq_sse2, transpose_sse2, add_f32_sse2,
+     sub_f32_sse2, scale_f32_sse2, eq_f32_sse2, transpose_f32_sse2},
+    {add_avx2, sub_avx2, scale_avx2, eq_avx2, transpose_avx2, add_f32_avx2,
+     sub_f32_avx2, scale_f32_avx2, eq_f32_avx2, transpose_f32_avx2},
+    {add_avx512, sub_avx512, scale_avx512, eq_avx512, transpose_avx512,
+     add_f32_avx512, sub_f32_avx512, scale_f32_avx512, eq_f32_avx512,
+     transpose_f32_avx2},
+#endif
+};
+
+static int best_level = S21_SIMD_SCALAR;
+static const s21_vec_kernels *active = &kernels[S21_SIMD_SCALAR];
+
+// Выбор ядер один раз при загрузке программы по данным CPUID
+__attribute__((constructor)) static void s21_simd_init(void) {
+#ifdef S21_SIMD_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) {
+    best_level = S21_SIMD_AVX512;
+  } else if (__builtin_cpu_supports("avx2")) {
+    best_level = S21_SIMD_AVX2;
+  } else if (__builtin_cpu_supports("sse2")) {
+    best_level = S21_SIMD_SSE2;
+  }
+#endif
+  active = &kernels[best_level];
+}
+
+int s21_simd_level(void) { return (int)(active - kernels); }
+
+int s21_simd_set_level(int level) {
+  if (level < S21_SIMD_SCALAR) level = S21_SIMD_SCALAR;
+  if (level > best_level) level = best_level;
+  active = &kernels[level];
+  return level;
+}
+
+void s21_vec_add(const double *a, const double *b, double *c, size_t n) {
+  active->add(a, b, c, n);
+}
+
+void s21_vec_sub(const double *a, const double *b, double *c, size_t n) {
+  active->sub(a, b, c, n);
+}
+
+void s21_vec_scale(const double *a, double k, double *c, size_t n) {
+  active->scale(a, k, c, n);
+}
+
+int s21_vec_eq(const double *a, const double *b, size_t n, double eps) {
+  return active->eq(a, b, n, eps);
+}
+
+void s21_vec_transpose(const double *a, ptrdiff_t lda, double *b,
+                       ptrdiff_t ldb, int rows, int cols) {
+  active->transpose(a, lda, b, ldb, rows, cols);
+}
+
+void s21_vec_add_f32(const float *a, const float *b, float *c, size_t n) {
+  active->add_f32(a, b, c, n);
+}
+
+void s21_vec_sub_f32(const float *a, const float *b, float *c, size_t n) {
+  active->sub_f32(a, b, c, n);
+}
+
+void s21_vec_scale_f32(const float *a, float k, float *c, size_t n) {
+  active->scale_f32(a, k, c, n);
+}
+
+int s21_vec_eq_f32(const float *a, const float *b, size_t n, float eps) {
+  return active->eq_f32(a, b, n, eps);
+}
+
+void s21_vec_transpose_f32(const float *a, ptrdiff_t lda, float *b,
+                           ptrdiff_t ldb, int rows, int cols) {
+  active->transpose_f32(a, lda, b, ldb, rows, cols);
+}
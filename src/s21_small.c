@@ -0,0 +1,150 @@
+#include <float.h>
+
+#include "s21_internal.h"
+
+// Явные формулы для матриц до 4 × 4, хранящихся по строкам без промежутков.
+// Все циклы развернуты: ни ветвлений по данным, ни рабочей памяти.
+
+static double det2(const double *a) { return a[0] * a[3] - a[1] * a[2]; }
+
+static double det3(const double *a) {
+  return a[0] * (a[4] * a[8] - a[5] * a[7]) -
+         a[1] * (a[3] * a[8] - a[5] * a[6]) +
+         a[2] * (a[3] * a[7] - a[4] * a[6]);
+}
+
+// Миноры 2 × 2 из двух верхних (s) и двух нижних (c) строк 4 × 4: по ним
+// раскладываются и определитель, и присоединенная матрица
+typedef struct {
+  double s[6];
+  double c[6];
+} minors4;
+
+static minors4 pair_minors4(const double *a) {
+  minors4 m;
+  m.s[0] = a[0] * a[5] - a[4] * a[1];
+  m.s[1] = a[0] * a[6] - a[4] * a[2];
+  m.s[2] = a[0] * a[7] - a[4] * a[3];
+  m.s[3] = a[1] * a[6] - a[5] * a[2];
+  m.s[4] = a[1] * a[7] - a[5] * a[3];
+  m.s[5] = a[2] * a[7] - a[6] * a[3];
+  m.c[0] = a[8] * a[13] - a[12] * a[9];
+  m.c[1] = a[8] * a[14] - a[12] * a[10];
+  m.c[2] = a[8] * a[15] - a[12] * a[11];
+  m.c[3] = a[9] * a[14] - a[13] * a[10];
+  m.c[4] = a[9] * a[15] - a[13] * a[11];
+  m.c[5] = a[10] * a[15] - a[14] * a[11];
+  return m;
+}
+
+static double det4_minors(const minors4 *m) {
+  return m->s[0] * m->c[5] - m->s[1] * m->c[4] + m->s[2] * m->c[3] +
+         m->s[3] * m->c[2] - m->s[4] * m->c[1] + m->s[5] * m->c[0];
+}
+
+// Присоединенные матрицы adj(A) = C^T, C - матрица дополнений
+
+static void adj2(const double *a, double *r) {
+  r[0] = a[3];
+  r[1] = -a[1];
+  r[2] = -a[2];
+  r[3] = a[0];
+}
+
+static void adj3(const double *a, double *r) {
+  r[0] = a[4] * a[8] - a[5] * a[7];
+  r[1] = a[2] * a[7] - a[1] * a[8];
+  r[2] = a[1] * a[5] - a[2] * a[4];
+  r[3] = a[5] * a[6] - a[3] * a[8];
+  r[4] = a[0] * a[8] - a[2] * a[6];
+  r[5] = a[2] * a[3] - a[0] * a[5];
+  r[6] = a[3] * a[7] - a[4] * a[6];
+  r[7] = a[1] * a[6] - a[0] * a[7];
+  r[8] = a[0] * a[4] - a[1] * a[3];
+}
+
+static void adj4(const double *a, const minors4 *m, double *r) {
+  const double *s = m->s;
+  const double *c = m->c;
+  r[0] = a[5] * c[5] - a[6] * c[4] + a[7] * c[3];
+  r[1] = -a[1] * c[5] + a[2] * c[4] - a[3] * c[3];
+  r[2] = a[13] * s[5] - a[14] * s[4] + a[15] * s[3];
+  r[3] = -a[9] * s[5] + a[10] * s[4] - a[11] * s[3];
+  r[4] = -a[4] * c[5] + a[6] * c[2] - a[7] * c[1];
+  r[5] = a[0] * c[5] - a[2] * c[2] + a[3] * c[1];
+  r[6] = -a[12] * s[5] + a[14] * s[2] - a[15] * s[1];
+  r[7] = a[8] * s[5] - a[10] * s[2] + a[11] * s[1];
+  r[8] = a[4] * c[4] - a[5] * c[2] + a[7] * c[0];
+  r[9] = -a[0] * c[4] + a[1] * c[2] - a[3] * c[0];
+  r[10] = a[12] * s[4] - a[13] * s[2] + a[15] * s[0];
+  r[11] = -a[8] * s[4] + a[9] * s[2] - a[11] * s[0];
+  r[12] = -a[4] * c[3] + a[5] * c[1] - a[6] * c[0];
+  r[13] = a[0] * c[3] - a[1] * c[1] + a[2] * c[0];
+  r[14] = -a[12] * s[3] + a[13] * s[1] - a[14] * s[0];
+  r[15] = a[8] * s[3] - a[9] * s[1] + a[10] * s[0];
+}
+
+double s21_small_det(const double *a, int n) {
+  double det = a[0];
+  if (n == 2) {
+    det = det2(a);
+  } else if (n == 3) {
+    det = det3(a);
+  } else if (n == 4) {
+    minors4 m = pair_minors4(a);
+    det = det4_minors(&m);
+  }
+  return det;
+}
+
+// adj(A) в r, возвращает det(A)
+static double small_adjugate(const double *a, int n, double *r) {
+  double det = a[0];
+  if (n == 1) {
+    r[0] = 1;  // Определитель пустого минора
+  } else if (n == 2) {
+    adj2(a, r);
+    det = det2(a);
+  } else if (n == 3) {
+    adj3(a, r);
+    det = a[0] * r[0] + a[1] * r[3] + a[2] * r[6];
+  } else {
+    minors4 m = pair_minors4(a);
+    adj4(a, &m, r);
+    det = det4_minors(&m);
+  }
+  return det;
+}
+
+void s21_small_cofactors(const double *a, int n, double *c) {
+  double adj[S21_SMALL_MAX * S21_SMALL_MAX];
+  small_adjugate(a, n, adj);
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) c[i * n + j] = adj[j * n + i];
+  }
+}
+
+int s21_small_inverse(const double *a, int n, double *inv) {
+  int code = S21_OK;
+  double adj[S21_SMALL_MAX * S21_SMALL_MAX];
+  double det = small_adjugate(a, n, adj);
+  // Порог относительно произведения максимумов строк (|det| не больше
+  // n^(n/2) × это произведение): умножение строки на число не меняет
+  // решения, и diag(1, 1e-6, 1e-6, 1e-6) с det = 1e-18 не вырождена.
+  // Общий max|A|^n отбраковывал такие хорошо обусловленные матрицы.
+  double tolerance = n * DBL_EPSILON;
+  for (int i = 0; i < n; i++) {
+    double row_max = 0;
+    for (int j = 0; j < n; j++) {
+      if (fabs(a[i * n + j]) > row_max) row_max = fabs(a[i * n + j]);
+    }
+    tolerance *= row_max;
+  }
+  if (!(fabs(det) > tolerance)) {
+    code = S21_CALC_ERROR;  // Матрица вырождена
+  } else {
+    double inv_det = 1.0 / det;
+    for (int i = 0; i < n * n; i++) inv[i] = adj[i] * inv_det;
+  }
+  return code;
+}
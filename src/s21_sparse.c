@@ -0,0 +1,345 @@
+#include "s21_internal.h"
+
+// Ниже этого числа умножений-сложений произведение считается в одном потоке
+#define S21_SPARSE_PARALLEL (1 << 16)
+// Частей параллельной задачи на поток: выравнивает нагрузку, если строки
+// заполнены неравномерно
+#define S21_SPARSE_SPLIT 4
+
+static int sparse_valid(const sparse_t *A) {
+  return A != NULL && A->offsets != NULL && A->rows >= 1 && A->columns >= 1 &&
+         (A->format == S21_CSR || A->format == S21_CSC);
+}
+
+// Число внешних (строки CSR, столбцы CSC) и внутренних индексов
+static int outer_size(const sparse_t *A) {
+  return A->format == S21_CSR ? A->rows : A->columns;
+}
+
+static int inner_size(const sparse_t *A) {
+  return A->format == S21_CSR ? A->columns : A->rows;
+}
+
+void s21_sparse_remove(sparse_t *A) {
+  if (A != NULL) {
+    free(A->offsets);
+    free(A->indices);
+    free(A->values);
+    A->offsets = NULL;
+    A->indices = NULL;
+    A->values = NULL;
+    A->rows = 0;
+    A->columns = 0;
+    A->nnz = 0;
+  }
+}
+
+// Выделяет массивы под nnz элементов; offsets заполнены нулями
+static int sparse_alloc(int rows, int columns, int nnz, int format,
+                        sparse_t *result) {
+  int code = S21_OK;
+  result->rows = rows;
+  result->columns = columns;
+  result->nnz = nnz;
+  result->format = format;
+  result->offsets = (int *)calloc((size_t)outer_size(result) + 1, sizeof(int));
+  // Хотя бы один элемент, чтобы пустая матрица не давала NULL
+  result->indices = (int *)malloc(((size_t)nnz + 1) * sizeof(int));
+  result->values = (double *)malloc(((size_t)nnz + 1) * sizeof(double));
+  if (result->offsets == NULL || result->indices == NULL ||
+      result->values == NULL) {
+    s21_sparse_remove(result);
+    code = S21_ERROR;
+  }
+  return code;
+}
+
+// Раскладка count элементов по внешнему индексу outer[t] в порядке,
+// заданном order (или в исходном, если order == NULL). Сортировка подсчетом
+// устойчива, поэтому порядок внутри строки сохраняется; next - рабочий
+// массив на outer_size(result) элементов.
+static void scatter(sparse_t *result, int count, const int *outer,
+                    const int *inner, const double *values, const int *order,
+                    int *next) {
+  int outer_count = outer_size(result);
+  for (int t = 0; t < count; t++) result->offsets[outer[t] + 1]++;
+  for (int i = 0; i < outer_count; i++) {
+    result->offsets[i + 1] += result->offsets[i];
+  }
+  memcpy(next, result->offsets, (size_t)outer_count * sizeof(int));
+  for (int s = 0; s < count; s++) {
+    int t = order != NULL ? order[s] : s;
+    int position = next[outer[t]]++;
+    result->indices[position] = inner[t];
+    result->values[position] = values[t];
+  }
+}
+
+// Сложение повторяющихся внутренних индексов в уже упорядоченных строках
+static void merge_duplicates(sparse_t *A) {
+  int outer_count = outer_size(A);
+  int write = 0;
+  int begin = 0;
+  for (int i = 0; i < outer_count; i++) {
+    int end = A->offsets[i + 1];
+    int row_start = write;
+    for (int p = begin; p < end; p++) {
+      if (write > row_start && A->indices[write - 1] == A->indices[p]) {
+        A->values[write - 1] += A->values[p];
+      } else {
+        A->indices[write] = A->indices[p];
+        A->values[write] = A->values[p];
+        write++;
+      }
+    }
+    begin = end;
+    A->offsets[i + 1] = write;
+  }
+  A->nnz = write;
+}
+
+int s21_sparse_from_triplets(int rows, int columns, int count,
+                             const int *row, const int *column,
+                             const double *values, int format,
+                             sparse_t *result) {
+  int code = S21_OK;
+  if (result == NULL || rows < 1 || columns < 1 || count < 0 ||
+      (count > 0 && (row == NULL || column == NULL || values == NULL)) ||
+      (format != S21_CSR && format != S21_CSC)) {
+    code = S21_ERROR;
+  }
+  for (int t = 0; t < count && code == S21_OK; t++) {
+    if (row[t] < 0 || row[t] >= rows || column[t] < 0 ||
+        column[t] >= columns) {
+      code = S21_CALC_ERROR;
+    }
+  }
+  const int *outer = format == S21_CSR ? row : column;
+  const int *inner = format == S21_CSR ? column : row;
+  int inner_count = format == S21_CSR ? columns : rows;
+  int outer_count = format == S21_CSR ? rows : columns;
+  int *order = NULL;
+  int *next = NULL;
+  if (code == S21_OK) {
+    code = sparse_alloc(rows, columns, count, format, result);
+  }
+  if (code == S21_OK) {
+    // Рабочая память: порядок по внутреннему индексу и счетчики
+    order = (int *)malloc(((size_t)count + 1) * sizeof(int));
+    int size = inner_count > outer_count ? inner_count : outer_count;
+    next = (int *)calloc((size_t)size + 1, sizeof(int));
+    if (order == NULL || next == NULL) {
+      s21_sparse_remove(result);
+      code = S21_ERROR;
+    }
+  }
+  if (code == S21_OK) {
+    // Два прохода сортировки подсчетом: сначала по внутреннему индексу,
+    // затем устойчиво по внешнему - строки получаются упорядоченными за
+    // O(count + rows + columns)
+    for (int t = 0; t < count; t++) next[inner[t] + 1]++;
+    for (int j = 0; j < inner_count; j++) next[j + 1] += next[j];
+    for (int t = 0; t < count; t++) order[next[inner[t]]++] = t;
+    scatter(result, count, outer, inner, values, order, next);
+    merge_duplicates(result);
+  }
+  free(order);
+  free(next);
+  return code;
+}
+
+int s21_sparse_from_dense(matrix_t *A, int format, sparse_t *result) {
+  int code = S21_OK;
+  if (A == NULL || A->matrix == NULL || result == NULL || A->rows < 1 ||
+      A->columns < 1 || (format != S21_CSR && format != S21_CSC)) {
+    code = S21_ERROR;
+  }
+  int nnz = 0;
+  for (int i = 0; code == S21_OK && i < A->rows; i++) {
+    for (int j = 0; j < A->columns; j++) nnz += A->matrix[i][j] != 0.0;
+  }
+  if (code == S21_OK) {
+    code = sparse_alloc(A->rows, A->columns, nnz, format, result);
+  }
+  if (code == S21_OK) {
+    int outer_count = outer_size(result);
+    int inner_count = inner_size(result);
+    int position = 0;
+    for (int o = 0; o < outer_count; o++) {
+      for (int in = 0; in < inner_count; in++) {
+        double value = format == S21_CSR ? A->matrix[o][in] : A->matrix[in][o];
+        if (value != 0.0) {
+          result->indices[position] = in;
+          result->values[position++] = value;
+        }
+      }
+      result->offsets[o + 1] = position;
+    }
+  }
+  return code;
+}
+
+int s21_sparse_to_dense(sparse_t *A, matrix_t *result) {
+  int code = S21_OK;
+  if (!sparse_valid(A) || result == NULL) {
+    code = S21_ERROR;
+  } else {
+    code = s21_create_matrix(A->rows, A->columns, result);
+  }
+  if (code == S21_OK) {
+    for (int o = 0; o < outer_size(A); o++) {
+      for (int p = A->offsets[o]; p < A->offsets[o + 1]; p++) {
+        int in = A->indices[p];
+        if (A->format == S21_CSR) {
+          result->matrix[o][in] = A->values[p];
+        } else {
+          result->matrix[in][o] = A->values[p];
+        }
+      }
+    }
+  }
+  return code;
+}
+
+int s21_sparse_convert(sparse_t *A, int format, sparse_t *result) {
+  int code = S21_OK;
+  int *outer = NULL;
+  int *next = NULL;
+  if (!sparse_valid(A) || result == NULL ||
+      (format != S21_CSR && format != S21_CSC)) {
+    code = S21_ERROR;
+  } else {
+    code = sparse_alloc(A->rows, A->columns, A->nnz, format, result);
+  }
+  if (code == S21_OK) {
+    outer = (int *)malloc(((size_t)A->nnz + 1) * sizeof(int));
+    next = (int *)malloc(((size_t)outer_size(result) + 1) * sizeof(int));
+    if (outer == NULL || next == NULL) {
+      s21_sparse_remove(result);
+      code = S21_ERROR;
+    }
+  }
+  if (code == S21_OK && format == A->format) {
+    memcpy(result->offsets, A->offsets,
+           ((size_t)outer_size(A) + 1) * sizeof(int));
+    memcpy(result->indices, A->indices, (size_t)A->nnz * sizeof(int));
+    memcpy(result->values, A->values, (size_t)A->nnz * sizeof(double));
+  } else if (code == S21_OK) {
+    // Смена формата - транспонирование структуры: элементы раскладываются
+    // по своему внутреннему индексу, проход по старым строкам по порядку
+    // оставляет новые строки упорядоченными
+    for (int o = 0; o < outer_size(A); o++) {
+      for (int p = A->offsets[o]; p < A->offsets[o + 1]; p++) outer[p] = o;
+    }
+    scatter(result, A->nnz, A->indices, outer, A->values, NULL, next);
+  }
+  free(outer);
+  free(next);
+  return code;
+}
+
+// Умножение CSR-матрицы на плотный блок: строки делятся на части с
+// примерно равным числом ненулевых элементов
+typedef struct {
+  const sparse_t *a;
+  const double *b;  // Плотный множитель, columns столбцов (вектор - 1)
+  double *c;
+  int columns;
+  int parts;
+} spmm_job;
+
+// Первая строка части part: первая строка, с которой начинается
+// part / parts доля ненулевых элементов
+static int part_row(const sparse_t *A, int part, int parts) {
+  long long target = (long long)A->nnz * part / parts;
+  int low = 0;
+  int high = A->rows;
+  while (low < high) {
+    int middle = low + (high - low) / 2;
+    if (A->offsets[middle] < target) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  return part == parts ? A->rows : low;
+}
+
+static void spmm_part(void *arg, int part, int worker) {
+  const spmm_job *job = (const spmm_job *)arg;
+  const sparse_t *a = job->a;
+  int begin = part_row(a, part, job->parts);
+  int end = part_row(a, part + 1, job->parts);
+  int n = job->columns;
+  (void)worker;
+  for (int i = begin; i < end; i++) {
+    double *c_row = job->c + (size_t)i * n;
+    if (n == 1) {
+      double sum = 0;
+      for (int p = a->offsets[i]; p < a->offsets[i + 1]; p++) {
+        sum += a->values[p] * job->b[a->indices[p]];
+      }
+      c_row[0] = sum;
+    } else {
+      memset(c_row, 0, (size_t)n * sizeof(double));
+      for (int p = a->offsets[i]; p < a->offsets[i + 1]; p++) {
+        double value = a->values[p];
+        const double *b_row = job->b + (size_t)a->indices[p] * n;
+        for (int j = 0; j < n; j++) c_row[j] += value * b_row[j];
+      }
+    }
+  }
+}
+
+// C = A × B для плотного B с n столбцами, хранящегося по строкам
+static void sparse_multiply(const sparse_t *A, const double *b, int n,
+                            double *c) {
+  if (A->format == S21_CSR) {
+    spmm_job job = {A, b, c, n, 1};
+    int threads = 1;
+    if ((double)A->nnz * n >= S21_SPARSE_PARALLEL) {
+      threads = s21_get_num_threads();
+    }
+    job.parts = threads > 1 ? threads * S21_SPARSE_SPLIT : 1;
+    s21_parallel_for(job.parts, spmm_part, &job, threads);
+  } else {
+    // В CSC столбец A разносится по строкам C; разные столбцы пишут в одни и
+    // те же строки, поэтому проход последовательный
+    memset(c, 0, (size_t)A->rows * n * sizeof(double));
+    for (int k = 0; k < A->columns; k++) {
+      const double *b_row = b + (size_t)k * n;
+      for (int p = A->offsets[k]; p < A->offsets[k + 1]; p++) {
+        double value = A->values[p];
+        double *c_row = c + (size_t)A->indices[p] * n;
+        for (int j = 0; j < n; j++) c_row[j] += value * b_row[j];
+      }
+    }
+  }
+}
+
+int s21_sparse_mult_vector(sparse_t *A, const double *x, double *y) {
+  int code = S21_OK;
+  if (!sparse_valid(A) || x == NULL || y == NULL) {
+    code = S21_ERROR;
+  } else if (x == y) {
+    code = S21_CALC_ERROR;
+  } else {
+    sparse_multiply(A, x, 1, y);
+  }
+  return code;
+}
+
+int s21_sparse_mult_matrix(sparse_t *A, matrix_t *B, matrix_t *result) {
+  int code = S21_OK;
+  if (!sparse_valid(A) || B == NULL || B->matrix == NULL || result == NULL) {
+    code = S21_ERROR;
+  } else if (A->columns != B->rows) {
+    code = S21_CALC_ERROR;
+  } else {
+    code = s21_create_matrix(A->rows, B->columns, result);
+  }
+  if (code == S21_OK) {
+    sparse_multiply(A, B->matrix[0], B->columns, result->matrix[0]);
+  }
+  return code;
+}
@@ -0,0 +1,206 @@
+#include "s21_internal.h"
+
+// Порог по умолчанию: ниже него блочное умножение быстрее рекурсии
+#define S21_STRASSEN_CUTOFF 512
+
+static int algorithm = S21_MULT_CLASSIC;
+static int cutoff = S21_STRASSEN_CUTOFF;
+
+int s21_set_mult_algorithm(int value) {
+  if (value != S21_MULT_STRASSEN) value = S21_MULT_CLASSIC;
+  __atomic_store_n(&algorithm, value, __ATOMIC_RELAXED);
+  return value;
+}
+
+int s21_get_mult_algorithm(void) {
+  return __atomic_load_n(&algorithm, __ATOMIC_RELAXED);
+}
+
+int s21_set_strassen_cutoff(int value) {
+  // Меньше 2 рекурсия не делит задачу
+  if (value < 1) value = S21_STRASSEN_CUTOFF;
+  if (value < 2) value = 2;
+  __atomic_store_n(&cutoff, value, __ATOMIC_RELAXED);
+  return value;
+}
+
+int s21_use_strassen(int m, int n, int k) {
+  int limit = __atomic_load_n(&cutoff, __ATOMIC_RELAXED);
+  return s21_get_mult_algorithm() == S21_MULT_STRASSEN && m >= limit &&
+         n >= limit && k >= limit;
+}
+
+// c = a + b и c = a - b для блоков rows × cols с шагами строк; c может
+// совпадать с a или b
+static void block_add(int rows, int cols, const double *a, ptrdiff_t lda,
+                      const double *b, ptrdiff_t ldb, double *c,
+                      ptrdiff_t ldc) {
+  for (int i = 0; i < rows; i++) {
+    s21_vec_add(a + i * lda, b + i * ldb, c + i * ldc, (size_t)cols);
+  }
+}
+
+static void block_sub(int rows, int cols, const double *a, ptrdiff_t lda,
+                      const double *b, ptrdiff_t ldb, double *c,
+                      ptrdiff_t ldc) {
+  for (int i = 0; i < rows; i++) {
+    s21_vec_sub(a + i * lda, b + i * ldb, c + i * ldc, (size_t)cols);
+  }
+}
+
+// Параметры рекурсии: порог и буфер упаковки s21_dgemm_ws для листьев
+typedef struct {
+  int limit;
+  int threads;
+  double *pack;
+} strassen_ctx;
+
+// Рабочая память для m × k на k × n (в элементах): на каждом уровне два
+// временных блока X и Y, уровни идут один за другим. Все листья рекурсии
+// одного размера, поэтому размер буфера упаковки (*pack) считается по нему.
+static size_t workspace_size(int m, int n, int k, const strassen_ctx *ctx,
+                             size_t *pack) {
+  size_t size = 0;
+  while (m >= ctx->limit && n >= ctx->limit && k >= ctx->limit) {
+    int m2 = m / 2;
+    int n2 = n / 2;
+    int k2 = k / 2;
+    size += (size_t)m2 * (k2 > n2 ? k2 : n2) + (size_t)k2 * n2;
+    m = m2;
+    n = n2;
+    k = k2;
+  }
+  *pack = s21_dgemm_ws_size(m, n, k, ctx->threads);
+  return size;
+}
+
+static void multiply(int m, int n, int k, const double *a, ptrdiff_t lda,
+                     const double *b, ptrdiff_t ldb, double *c, ptrdiff_t ldc,
+                     double *ws, const strassen_ctx *ctx);
+
+// Один уровень Штрассена-Винограда для четных m, n, k: 7 умножений половин
+// и 15 сложений. Порядок вычислений (Boyer, Dumas, Pernet, Zhou) использует
+// четверти C как рабочую память, поэтому кроме них нужны только X (m/2 ×
+// max(k/2, n/2)) и Y (k/2 × n/2).
+static void winograd(int m, int n, int k, const double *a, ptrdiff_t lda,
+                     const double *b, ptrdiff_t ldb, double *c, ptrdiff_t ldc,
+                     double *ws, const strassen_ctx *ctx) {
+  int m2 = m / 2;
+  int n2 = n / 2;
+  int k2 = k / 2;
+  const double *a11 = a;
+  const double *a12 = a + k2;
+  const double *a21 = a + m2 * lda;
+  const double *a22 = a21 + k2;
+  const double *b11 = b;
+  const double *b12 = b + n2;
+  const double *b21 = b + k2 * ldb;
+  const double *b22 = b21 + n2;
+  double *c11 = c;
+  double *c12 = c + n2;
+  double *c21 = c + m2 * ldc;
+  double *c22 = c21 + n2;
+  double *x = ws;
+  double *y = x + (size_t)m2 * (k2 > n2 ? k2 : n2);
+  double *next = y + (size_t)k2 * n2;
+  block_sub(m2, k2, a11, lda, a21, lda, x, k2);  // S3 = A11 - A21
+  block_sub(k2, n2, b22, ldb, b12, ldb, y, n2);  // T3 = B22 - B12
+  // P7 = S3 × T3
+  multiply(m2, n2, k2, x, k2, y, n2, c21, ldc, next, ctx);
+  block_add(m2, k2, a21, lda, a22, lda, x, k2);  // S1 = A21 + A22
+  block_sub(k2, n2, b12, ldb, b11, ldb, y, n2);  // T1 = B12 - B11
+  // P5 = S1 × T1
+  multiply(m2, n2, k2, x, k2, y, n2, c22, ldc, next, ctx);
+  block_sub(m2, k2, x, k2, a11, lda, x, k2);  // S2 = S1 - A11
+  block_sub(k2, n2, b22, ldb, y, n2, y, n2);  // T2 = B22 - T1
+  // P6 = S2 × T2
+  multiply(m2, n2, k2, x, k2, y, n2, c12, ldc, next, ctx);
+  block_sub(m2, k2, a12, lda, x, k2, x, k2);  // S4 = A12 - S2
+  // P3 = S4 × B22
+  multiply(m2, n2, k2, x, k2, b22, ldb, c11, ldc, next, ctx);
+  // P1 = A11 × B11
+  multiply(m2, n2, k2, a11, lda, b11, ldb, x, n2, next, ctx);
+  block_add(m2, n2, x, n2, c12, ldc, c12, ldc);     // U2 = P1 + P6
+  block_add(m2, n2, c12, ldc, c21, ldc, c21, ldc);  // U3 = U2 + P7
+  block_add(m2, n2, c12, ldc, c22, ldc, c12, ldc);  // U4 = U2 + P5
+  block_add(m2, n2, c21, ldc, c22, ldc, c22, ldc);  // U7 = U3 + P5
+  block_add(m2, n2, c12, ldc, c11, ldc, c12, ldc);  // U5 = U4 + P3
+  block_sub(k2, n2, y, n2, b21, ldb, y, n2);        // T4 = T2 - B21
+  // P4 = A22 × T4
+  multiply(m2, n2, k2, a22, lda, y, n2, c11, ldc, next, ctx);
+  block_sub(m2, n2, c21, ldc, c11, ldc, c21, ldc);  // U6 = U3 - P4
+  // P2 = A12 × B21
+  multiply(m2, n2, k2, a12, lda, b21, ldb, c11, ldc, next, ctx);
+  block_add(m2, n2, x, n2, c11, ldc, c11, ldc);  // U1 = P1 + P2
+}
+
+// Отщепленные при нечетных размерах части: последнее слагаемое по k
+// (me × ne), последний столбец (m × 1) и последняя строка (1 × ne) C.
+// Это произведения ранга 1 и на вектор, упаковка для них не окупается.
+static void multiply_edges(int m, int n, int k, const double *a,
+                           ptrdiff_t lda, const double *b, ptrdiff_t ldb,
+                           double *c, ptrdiff_t ldc) {
+  int me = m & ~1;
+  int ne = n & ~1;
+  int ke = k & ~1;
+  if (ke < k) {
+    const double *b_k = b + ke * ldb;
+    for (int i = 0; i < me; i++) {
+      double a_ik = a[i * lda + ke];
+      double *c_i = c + i * ldc;
+      for (int j = 0; j < ne; j++) c_i[j] += a_ik * b_k[j];
+    }
+  }
+  if (ne < n) {
+    for (int i = 0; i < m; i++) {
+      const double *a_i = a + i * lda;
+      double sum = 0;
+      for (int p = 0; p < k; p++) sum += a_i[p] * b[p * ldb + ne];
+      c[i * ldc + ne] = sum;
+    }
+  }
+  if (me < m) {
+    const double *a_m = a + me * lda;
+    double *c_m = c + me * ldc;
+    for (int j = 0; j < ne; j++) c_m[j] = 0;
+    for (int p = 0; p < k; p++) {
+      double a_mp = a_m[p];
+      const double *b_p = b + p * ldb;
+      for (int j = 0; j < ne; j++) c_m[j] += a_mp * b_p[j];
+    }
+  }
+}
+
+// C = A × B. Нечетные размеры "отщепляются": рекурсия идет по четной части,
+// а последние строка, столбец и слагаемое по k добавляются отдельно, без
+// дополнения матриц нулями.
+static void multiply(int m, int n, int k, const double *a, ptrdiff_t lda,
+                     const double *b, ptrdiff_t ldb, double *c, ptrdiff_t ldc,
+                     double *ws, const strassen_ctx *ctx) {
+  if (m < ctx->limit || n < ctx->limit || k < ctx->limit) {
+    s21_dgemm_ws(m, n, k, 1.0, a, lda, 1, b, ldb, 1, 0.0, c, ldc,
+                 ctx->threads, ctx->pack);
+  } else {
+    winograd(m & ~1, n & ~1, k & ~1, a, lda, b, ldb, c, ldc, ws, ctx);
+    multiply_edges(m, n, k, a, lda, b, ldb, c, ldc);
+  }
+}
+
+int s21_strassen(int m, int n, int k, const double *a, ptrdiff_t lda,
+                 const double *b, ptrdiff_t ldb, double *c, ptrdiff_t ldc) {
+  int code = S21_OK;
+  strassen_ctx ctx = {.limit = __atomic_load_n(&cutoff, __ATOMIC_RELAXED),
+                      .threads = s21_get_num_threads()};
+  // Вся рабочая память рекурсии и буфер упаковки - один блок
+  size_t pack = 0;
+  size_t size = workspace_size(m, n, k, &ctx, &pack);
+  double *ws = (double *)malloc((pack + size + 1) * sizeof(double));
+  if (ws == NULL) {
+    code = S21_ERROR;
+  } else {
+    ctx.pack = ws;
+    multiply(m, n, k, a, lda, b, ldb, c, ldc, ws + pack, &ctx);
+    free(ws);
+  }
+  return code;
+}
@@ -0,0 +1,421 @@
+#include <errno.h>
+#include <locale.h>
+#include <unistd.h>
+
+#include "s21_internal.h"
+
+#define S21_TEXT_CHUNK (1 << 20)  // Размер буфера чтения и записи
+#define S21_TEXT_TOKEN 128  // Длина числа для медленного пути через strtod
+
+// Степени 10, точно представимые в double
+static const double powers[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                                1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                                1e18, 1e19, 1e20, 1e21, 1e22};
+
+#define S21_TEXT_MAX_POWER 22
+
+// Ближайший к m × 10^exponent double, |exponent| <= 22. При m <= 2^53 оба
+// множителя точные, и единственное округление дает ответ (Clinger). Большие
+// m умножаются в double-double (hi + lo, ошибка ~2^-103): ответ - hi + lo,
+// если точное значение заведомо не лежит у середины между соседними double.
+// @return 0, если результат так гарантировать нельзя
+static int decimal_to_double(uint64_t m, int exponent, double *value) {
+  int found = 0;
+  if (exponent < -S21_TEXT_MAX_POWER || exponent > S21_TEXT_MAX_POWER) {
+    found = 0;
+  } else if (m <= (1ull << 53)) {
+    *value = exponent >= 0 ? (double)m * powers[exponent]
+                           : (double)m / powers[-exponent];
+    found = 1;
+  } else {
+    double p = powers[exponent >= 0 ? exponent : -exponent];
+    double mh = (double)m;
+    double ml = (double)(int64_t)(m - (uint64_t)mh);
+    double hi = 0;
+    double lo = 0;
+    if (exponent >= 0) {
+      hi = mh * p;
+      lo = fma(mh, p, -hi) + ml * p;
+    } else {
+      hi = mh / p;
+      lo = (fma(-hi, p, mh) + ml) / p;
+    }
+    double sum = hi + lo;
+    double tail = lo - (sum - hi);
+    int e2 = 0;
+    double fraction = frexp(sum, &e2);
+    // Половина ulp(sum); у степени двойки ulp снизу вдвое меньше
+    double half = ldexp(1, e2 - 54);
+    found = fraction != 0.5 &&
+            fabs(fabs(tail) - half) > fabs(sum) * 0x1p-98;
+    *value = sum;
+  }
+  return found;
+}
+
+static int is_separator(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == ',' ||
+         c == ';';
+}
+
+// Медленный путь: strtod над копией числа, в которой точка заменена на
+// десятичный разделитель текущей локали, чтобы результат от нее не зависел
+static int parse_slow(const char *p, size_t length, char point,
+                      double *value) {
+  int code = S21_OK;
+  char token[S21_TEXT_TOKEN + 1];
+  if (length > S21_TEXT_TOKEN) {
+    code = S21_CALC_ERROR;
+  } else {
+    for (size_t i = 0; i < length; i++) token[i] = p[i] == '.' ? point : p[i];
+    token[length] = '\0';
+    char *end = NULL;
+    *value = strtod(token, &end);
+    if (end != token + length) code = S21_CALC_ERROR;
+  }
+  return code;
+}
+
+// Разбор числа [+-]digits[.digits][(e|E)[+-]digits] из [p, p + length).
+// Быстрый путь - до 19 значащих цифр в uint64_t и decimal_to_double;
+// остальное (длинные мантиссы, большие порядки, inf, nan) - через strtod.
+static int parse_double(const char *p, size_t length, char point,
+                        double *value) {
+  const char *c = p;
+  const char *end = p + length;
+  int negative = 0;
+  uint64_t m = 0;
+  int significant = 0;
+  int exponent = 0;
+  int digits = 0;
+  int exact = 1;
+  if (c < end && (*c == '-' || *c == '+')) negative = *c++ == '-';
+  for (; c < end && *c >= '0' && *c <= '9'; c++, digits++) {
+    if (significant < 19) {
+      m = m * 10 + (uint64_t)(*c - '0');
+      if (m > 0) significant++;
+    } else {
+      exponent++;
+      exact = 0;
+    }
+  }
+  if (c < end && *c == '.') {
+    for (c++; c < end && *c >= '0' && *c <= '9'; c++, digits++) {
+      if (significant < 19) {
+        m = m * 10 + (uint64_t)(*c - '0');
+        if (m > 0) significant++;
+        exponent--;
+      } else {
+        exact = 0;
+      }
+    }
+  }
+  if (digits > 0 && c < end && (*c == 'e' || *c == 'E')) {
+    const char *mark = c++;
+    int sign = 1;
+    int power = 0;
+    if (c < end && (*c == '-' || *c == '+')) sign = *c++ == '-' ? -1 : 1;
+    if (c == end) c = mark;  // Нет цифр порядка - ошибка ниже
+    for (; c < end && *c >= '0' && *c <= '9'; c++) {
+      if (power < 100000) power = power * 10 + (*c - '0');
+    }
+    exponent += sign * power;
+  }
+  int code = S21_OK;
+  if (digits > 0 && c == end && exact &&
+      decimal_to_double(m, exponent, value)) {
+    if (negative) *value = -*value;
+  } else {
+    code = parse_slow(p, length, point, value);
+  }
+  return code;
+}
+
+// Разбор текста: значения копятся в растущем массиве, число столбцов
+// берется из первой непустой строки
+typedef struct {
+  double *values;
+  size_t count;
+  size_t capacity;
+  int rows;
+  int columns;
+  int row_columns;  // Значений в текущей строке
+  int comma;        // После последнего значения была запятая
+  char point;
+} text_state;
+
+static int push_value(text_state *state, double value) {
+  int code = S21_OK;
+  if (state->count == state->capacity) {
+    size_t capacity = state->capacity ? state->capacity * 2 : 1 << 16;
+    double *values = NULL;
+    if (capacity <= SIZE_MAX / sizeof(double)) {
+      values = (double *)realloc(state->values, capacity * sizeof(double));
+    }
+    if (values == NULL) {
+      code = S21_ERROR;
+    } else {
+      state->values = values;
+      state->capacity = capacity;
+    }
+  }
+  if (code == S21_OK && state->row_columns == INT32_MAX) {
+    code = S21_CALC_ERROR;
+  }
+  if (code == S21_OK) {
+    state->values[state->count++] = value;
+    state->row_columns++;
+    state->comma = 0;
+  }
+  return code;
+}
+
+static int end_row(text_state *state) {
+  int code = S21_OK;
+  if (state->comma) {
+    code = S21_CALC_ERROR;  // Пустое поле в конце строки
+  } else if (state->row_columns > 0) {
+    if (state->rows == 0) {
+      state->columns = state->row_columns;
+    } else if (state->row_columns != state->columns) {
+      code = S21_CALC_ERROR;
+    }
+    if (code == S21_OK && state->rows == INT32_MAX) code = S21_CALC_ERROR;
+    if (code == S21_OK) state->rows++;
+    state->row_columns = 0;
+  }
+  return code;
+}
+
+// Разбирает buffer[*position, filled). Число, упирающееся в конец буфера,
+// до конца файла не разбирается: *position остается на его начале.
+static int parse_chunk(text_state *state, const char *buffer, size_t filled,
+                       size_t *position, int eof) {
+  int code = S21_OK;
+  size_t i = *position;
+  int wait = 0;
+  while (i < filled && code == S21_OK && !wait) {
+    char c = buffer[i];
+    if (c == '\n') {
+      code = end_row(state);
+      i++;
+    } else if (c == ' ' || c == '\t' || c == '\r') {
+      i++;
+    } else if (c == ',' || c == ';') {
+      // Запятая разделяет два значения одной строки
+      if (state->row_columns == 0 || state->comma) code = S21_CALC_ERROR;
+      state->comma = 1;
+      i++;
+    } else {
+      size_t start = i;
+      while (i < filled && !is_separator(buffer[i])) i++;
+      if (i == filled && !eof) {
+        wait = 1;
+        i = start;
+      } else {
+        double value = 0;
+        code = parse_double(buffer + start, i - start, state->point, &value);
+        if (code == S21_OK) code = push_value(state, value);
+      }
+    }
+  }
+  *position = i;
+  return code;
+}
+
+// Переносит разобранный массив в блок матрицы: блок увеличивается через
+// realloc, и данные сдвигаются за массив указателей на строки
+static int finish_matrix(text_state *state, matrix_t *result) {
+  int code = S21_OK;
+  size_t size = s21_matrix_block_size(state->rows, state->columns);
+  void *block = NULL;
+  if (size == 0) {
+    code = S21_CALC_ERROR;  // Пустой текст
+  } else {
+    block = realloc(state->values, size);
+    if (block == NULL) code = S21_ERROR;
+  }
+  if (code == S21_OK) {
+    state->values = NULL;
+    memmove(s21_matrix_data(block, state->rows), block,
+            state->count * sizeof(double));
+    s21_matrix_attach(block, state->rows, state->columns, S21_OWNER_HEAP,
+                      result);
+  }
+  return code;
+}
+
+int s21_read_matrix_fd(int fd, matrix_t *result) {
+  int code = S21_OK;
+  char *buffer = NULL;
+  text_state state = {0};
+  if (fd < 0 || result == NULL) {
+    code = S21_ERROR;
+  } else {
+    buffer = (char *)malloc(S21_TEXT_CHUNK);
+    if (buffer == NULL) code = S21_ERROR;
+  }
+  if (code == S21_OK) {
+    state.point = localeconv()->decimal_point[0];
+    size_t filled = 0;
+    size_t position = 0;
+    int eof = 0;
+    while (code == S21_OK && !eof) {
+      // Неразобранный хвост переносится в начало буфера
+      memmove(buffer, buffer + position, filled - position);
+      filled -= position;
+      position = 0;
+      if (filled == S21_TEXT_CHUNK) code = S21_CALC_ERROR;
+      ssize_t done = 0;
+      while (code == S21_OK &&
+             (done = read(fd, buffer + filled, S21_TEXT_CHUNK - filled)) < 0) {
+        if (errno != EINTR) code = S21_CALC_ERROR;
+      }
+      if (code == S21_OK) {
+        filled += (size_t)done;
+        eof = done == 0;
+        code = parse_chunk(&state, buffer, filled, &position, eof);
+      }
+    }
+    if (code == S21_OK) code = end_row(&state);
+    if (code == S21_OK) code = finish_matrix(&state, result);
+  }
+  free(buffer);
+  free(state.values);
+  if (code != S21_OK && result != NULL) {
+    result->matrix = NULL;
+    result->rows = 0;
+    result->columns = 0;
+  }
+  return code;
+}
+
+// Округляет v > 0 до digits значащих цифр: v ≈ m × 10^(e10 - digits + 1),
+// 10^(digits - 1) <= m < 10^digits. v × 10^k считается в double-double, как
+// в decimal_to_double. @return 0 при слишком большом или малом порядке и
+// когда дробная часть слишком близка к 1/2, чтобы округлить ее надежно
+static int round_digits(double v, int digits, uint64_t *m, int *e10) {
+  int found = 0;
+  int settled = 0;
+  uint64_t low = 1;
+  for (int i = 1; i < digits; i++) low *= 10;
+  int e2 = 0;
+  frexp(v, &e2);
+  *e10 = (int)floor((e2 - 1) * 0.30102999566398120);
+  // Оценка порядка может ошибиться на единицу в любую сторону
+  for (int attempt = 0; attempt < 3 && !settled; attempt++) {
+    int k = digits - 1 - *e10;
+    settled = 1;
+    if (k >= -S21_TEXT_MAX_POWER && k <= S21_TEXT_MAX_POWER) {
+      double p = powers[k >= 0 ? k : -k];
+      double hi = k >= 0 ? v * p : v / p;
+      double lo = k >= 0 ? fma(v, p, -hi) : fma(-hi, p, v) / p;
+      double whole = floor(hi);
+      double fraction = (hi - whole) + lo;
+      double rest = fraction - floor(fraction);
+      *m = (uint64_t)whole + (uint64_t)(int64_t)floor(fraction + 0.5);
+      if (*m >= low * 10) {
+        (*e10)++;
+        settled = 0;
+      } else if (*m < low) {
+        (*e10)--;
+        settled = 0;
+      } else {
+        found = fabs(rest - 0.5) > 0x1p-40;
+      }
+    }
+  }
+  return found;
+}
+
+// Запись числа в out (не меньше 32 байт), @return длина. Быстрый путь: самая
+// короткая из записей в 15, 16 и 17 значащих цифр, которую decimal_to_double
+// возвращает в то же число (17 цифр всегда достаточно). Иначе - "%.17g".
+static int format_double(double value, char *out, char point) {
+  int length = 0;
+  uint64_t m = 0;
+  int e10 = 0;
+  int count = 0;
+  double v = fabs(value);
+  for (int digits = 15; digits <= 17 && count == 0 && isfinite(value) &&
+                        value != 0;
+       digits++) {
+    double back = 0;
+    if (round_digits(v, digits, &m, &e10) &&
+        decimal_to_double(m, e10 - digits + 1, &back) && back == v) {
+      count = digits;
+    }
+  }
+  if (value == 0) {
+    length = signbit(value) ? sprintf(out, "-0") : sprintf(out, "0");
+  } else if (count > 0) {
+    char digits[17];
+    while (m % 10 == 0) {
+      m /= 10;
+      count--;
+    }
+    for (int i = count - 1; i >= 0; i--, m /= 10) {
+      digits[i] = (char)('0' + m % 10);
+    }
+    if (value < 0) out[length++] = '-';
+    if (e10 >= 0 && e10 < 17) {
+      // d…d[.d…d]
+      for (int i = 0; i <= e10; i++) {
+        out[length++] = i < count ? digits[i] : '0';
+      }
+      if (count > e10 + 1) out[length++] = '.';
+      for (int i = e10 + 1; i < count; i++) out[length++] = digits[i];
+    } else if (e10 < 0 && e10 >= -4) {
+      // 0.0…0d…d
+      out[length++] = '0';
+      out[length++] = '.';
+      for (int i = -1; i > e10; i--) out[length++] = '0';
+      for (int i = 0; i < count; i++) out[length++] = digits[i];
+    } else {
+      // d[.d…d]e±dd
+      out[length++] = digits[0];
+      if (count > 1) out[length++] = '.';
+      for (int i = 1; i < count; i++) out[length++] = digits[i];
+      length += sprintf(out + length, "e%+03d", e10);
+    }
+  } else {
+    length = snprintf(out, 32, "%.17g", value);
+    for (int i = 0; i < length; i++) {
+      if (out[i] == point) out[i] = '.';
+    }
+  }
+  return length;
+}
+
+int s21_write_matrix_fd(int fd, matrix_t *A, char separator) {
+  int code = S21_OK;
+  char *buffer = NULL;
+  if (fd < 0 || A == NULL || A->matrix == NULL || A->rows < 1 ||
+      A->columns < 1 || !is_separator(separator) || separator == '\n' ||
+      separator == '\r') {
+    code = S21_ERROR;
+  } else {
+    buffer = (char *)malloc(S21_TEXT_CHUNK);
+    if (buffer == NULL) code = S21_ERROR;
+  }
+  if (code == S21_OK) {
+    char point = localeconv()->decimal_point[0];
+    size_t filled = 0;
+    for (int i = 0; i < A->rows && code == S21_OK; i++) {
+      for (int j = 0; j < A->columns && code == S21_OK; j++) {
+        // Место под число и разделитель
+        if (S21_TEXT_CHUNK - filled < 40) {
+          code = s21_write_all(fd, buffer, filled);
+          filled = 0;
+        }
+        filled += (size_t)format_double(A->matrix[i][j], buffer + filled,
+                                        point);
+        buffer[filled++] = j + 1 < A->columns ? separator : '\n';
+      }
+    }
+    if (code == S21_OK) code = s21_write_all(fd, buffer, filled);
+  }
+  free(buffer);
+  return code;
+}
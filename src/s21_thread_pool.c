@@ -0,0 +1,152 @@
+#include <pthread.h>
+#include <unistd.h>
+
+#include "s21_internal.h"
+
+#define S21_MAX_THREADS 256
+
+// Постоянный пул потоков: потоки создаются при первой параллельной задаче и
+// ждут следующих задач на условной переменной
+static struct {
+  pthread_mutex_t lock;
+  pthread_cond_t wake;  // Новая задача или остановка пула
+  pthread_cond_t done;  // Все части задачи выполнены
+  pthread_t threads[S21_MAX_THREADS];
+  int workers;                // Запущено рабочих потоков (без вызывающего)
+  int stop;                   // Потокам пора завершаться
+  unsigned long generation;   // Номер текущей задачи
+  s21_task_fn fn;             // Текущая задача
+  void *arg;
+  int count;     // Число частей задачи
+  int next;      // Следующая невыданная часть
+  int finished;  // Выполнено частей
+  int limit;     // Части берут только потоки с номером меньше limit
+} pool = {.lock = PTHREAD_MUTEX_INITIALIZER,
+          .wake = PTHREAD_COND_INITIALIZER,
+          .done = PTHREAD_COND_INITIALIZER};
+
+// Одновременно пул выполняет одну задачу
+static pthread_mutex_t job_lock = PTHREAD_MUTEX_INITIALIZER;
+static int num_threads = 0;  // 0 - еще не задано
+static int exit_registered = 0;
+// Поток уже выполняет часть задачи: вложенные вызовы идут последовательно
+static _Thread_local int inside_pool = 0;
+
+// Выполняет части текущей задачи, пока они есть. Вызывается под pool.lock.
+static void run_parts(int id) {
+  while (id < pool.limit && pool.next < pool.count) {
+    s21_task_fn fn = pool.fn;
+    void *arg = pool.arg;
+    int part = pool.next++;
+    pthread_mutex_unlock(&pool.lock);
+    fn(arg, part, id);
+    pthread_mutex_lock(&pool.lock);
+    if (++pool.finished == pool.count) {
+      pthread_cond_broadcast(&pool.done);
+    }
+  }
+}
+
+static void *worker_main(void *data) {
+  int id = (int)(intptr_t)data;
+  unsigned long seen = 0;
+  inside_pool = 1;
+  pthread_mutex_lock(&pool.lock);
+  while (!pool.stop) {
+    if (pool.generation == seen) {
+      pthread_cond_wait(&pool.wake, &pool.lock);
+    } else {
+      seen = pool.generation;
+      run_parts(id);
+    }
+  }
+  pthread_mutex_unlock(&pool.lock);
+  return NULL;
+}
+
+// Останавливает и дожидается всех рабочих потоков. Вызывается под job_lock.
+static void stop_workers(void) {
+  pthread_mutex_lock(&pool.lock);
+  pool.stop = 1;
+  pthread_cond_broadcast(&pool.wake);
+  pthread_mutex_unlock(&pool.lock);
+  for (int i = 0; i < pool.workers; i++) {
+    pthread_join(pool.threads[i], NULL);
+  }
+  pool.workers = 0;
+  pool.stop = 0;
+}
+
+static void shutdown_pool(void) {
+  pthread_mutex_lock(&job_lock);
+  stop_workers();
+  pthread_mutex_unlock(&job_lock);
+}
+
+// Запускает недостающие рабочие потоки. Вызывается под job_lock.
+static void start_workers(int wanted) {
+  if (!exit_registered) {
+    exit_registered = atexit(shutdown_pool) == 0;
+  }
+  while (pool.workers < wanted) {
+    if (pthread_create(&pool.threads[pool.workers], NULL, worker_main,
+                       (void *)(intptr_t)(pool.workers + 1)) != 0) {
+      break;  // Работаем с теми потоками, что удалось создать
+    }
+    pool.workers++;
+  }
+}
+
+static int default_threads(void) {
+  int threads = 0;
+  const char *env = getenv("S21_NUM_THREADS");
+  if (env != NULL) threads = atoi(env);
+  if (threads < 1) threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  return threads < 1 ? 1 : threads;
+}
+
+int s21_set_num_threads(int threads) {
+  if (threads < 1) threads = default_threads();
+  if (threads > S21_MAX_THREADS) threads = S21_MAX_THREADS;
+  pthread_mutex_lock(&job_lock);
+  if (pool.workers > threads - 1) stop_workers();
+  __atomic_store_n(&num_threads, threads, __ATOMIC_RELAXED);
+  pthread_mutex_unlock(&job_lock);
+  return threads;
+}
+
+int s21_get_num_threads(void) {
+  int threads = __atomic_load_n(&num_threads, __ATOMIC_RELAXED);
+  return threads > 0 ? threads : s21_set_num_threads(0);
+}
+
+void s21_parallel_for(int count, s21_task_fn fn, void *arg, int max_threads) {
+  int threads = s21_get_num_threads();
+  if (threads > max_threads) threads = max_threads;
+  // Мелкие задачи, вложенные вызовы и вызовы при занятом пуле выполняются
+  // в вызывающем потоке
+  int serial = count <= 1 || threads <= 1 || inside_pool ||
+               pthread_mutex_trylock(&job_lock) != 0;
+  if (serial) {
+    for (int part = 0; part < count; part++) fn(arg, part, 0);
+  } else {
+    start_workers(threads - 1);
+    pthread_mutex_lock(&pool.lock);
+    pool.fn = fn;
+    pool.arg = arg;
+    pool.count = count;
+    pool.next = 0;
+    pool.finished = 0;
+    pool.limit = threads;
+    pool.generation++;
+    pthread_cond_broadcast(&pool.wake);
+    inside_pool = 1;
+    run_parts(0);
+    inside_pool = 0;
+    while (pool.finished < pool.count) {
+      pthread_cond_wait(&pool.done, &pool.lock);
+    }
+    pthread_mutex_unlock(&pool.lock);
+    pthread_mutex_unlock(&job_lock);
+  }
+}
@@ -0,0 +1,147 @@
+#include <string.h>
+
+#include "s21_internal.h"
+
+// Сторона плитки: две плитки 32 × 32 (16 КиБ) помещаются в L1
+#define S21_TRANSPOSE_TILE 32
+
+static int min_int(int a, int b) { return a < b ? a : b; }
+
+// Ядро листа рекурсии для элементов одного типа
+typedef void (*transpose_leaf)(const void *a, ptrdiff_t lda, void *b,
+                               ptrdiff_t ldb, int rows, int cols);
+
+static void leaf_f64(const void *a, ptrdiff_t lda, void *b, ptrdiff_t ldb,
+                     int rows, int cols) {
+  s21_vec_transpose((const double *)a, lda, (double *)b, ldb, rows, cols);
+}
+
+static void leaf_f32(const void *a, ptrdiff_t lda, void *b, ptrdiff_t ldb,
+                     int rows, int cols) {
+  s21_vec_transpose_f32((const float *)a, lda, (float *)b, ldb, rows, cols);
+}
+
+// Общая рекурсия для double и float: lda и ldb в элементах, смещения
+// считаются в байтах по размеру элемента size
+static void transpose_recursive(const char *a, ptrdiff_t lda, char *b,
+                                ptrdiff_t ldb, int rows, int cols, size_t size,
+                                transpose_leaf leaf) {
+  if (rows <= S21_TRANSPOSE_TILE && cols <= S21_TRANSPOSE_TILE) {
+    leaf(a, lda, b, ldb, rows, cols);
+  } else if (rows >= cols) {
+    // Половина округляется до 8, чтобы плитки SIMD-ядра не рвались
+    int half = (rows / 2 + 7) & ~7;
+    transpose_recursive(a, lda, b, ldb, half, cols, size, leaf);
+    transpose_recursive(a + half * lda * size, lda, b + half * size, ldb,
+                        rows - half, cols, size, leaf);
+  } else {
+    int half = (cols / 2 + 7) & ~7;
+    transpose_recursive(a, lda, b, ldb, rows, half, size, leaf);
+    transpose_recursive(a + half * size, lda, b + half * ldb * size, ldb,
+                        rows, cols - half, size, leaf);
+  }
+}
+
+void s21_transpose_block(const double *a, ptrdiff_t lda, double *b,
+                         ptrdiff_t ldb, int rows, int cols) {
+  transpose_recursive((const char *)a, lda, (char *)b, ldb, rows, cols,
+                      sizeof(double), leaf_f64);
+}
+
+void s21_transpose_block_f32(const float *a, ptrdiff_t lda, float *b,
+                             ptrdiff_t ldb, int rows, int cols) {
+  transpose_recursive((const char *)a, lda, (char *)b, ldb, rows, cols,
+                      sizeof(float), leaf_f32);
+}
+
+// Квадратная матрица n × n: диагональные плитки транспонируются через буфер,
+// симметричные пары плиток меняются местами с транспонированием
+static void transpose_square(double *a, int n) {
+  double tile[S21_TRANSPOSE_TILE * S21_TRANSPOSE_TILE];
+  for (int i0 = 0; i0 < n; i0 += S21_TRANSPOSE_TILE) {
+    int bi = min_int(S21_TRANSPOSE_TILE, n - i0);
+    double *diagonal = a + (size_t)i0 * n + i0;
+    s21_vec_transpose(diagonal, n, tile, bi, bi, bi);
+    for (int r = 0; r < bi; r++) {
+      memcpy(diagonal + (size_t)r * n, tile + r * bi, bi * sizeof(double));
+    }
+    for (int j0 = i0 + bi; j0 < n; j0 += S21_TRANSPOSE_TILE) {
+      int bj = min_int(S21_TRANSPOSE_TILE, n - j0);
+      double *upper = a + (size_t)i0 * n + j0;  // bi × bj
+      double *lower = a + (size_t)j0 * n + i0;  // bj × bi
+      s21_vec_transpose(upper, n, tile, bi, bi, bj);
+      s21_vec_transpose(lower, n, upper, n, bj, bi);
+      for (int r = 0; r < bj; r++) {
+        memcpy(lower + (size_t)r * n, tile + r * bi, bi * sizeof(double));
+      }
+    }
+  }
+}
+
+// Прямоугольная матрица rows × columns по строкам: элемент с индексом i
+// (кроме первого и последнего) переходит на место i × rows mod (size - 1).
+// Каждый цикл этой перестановки обходится один раз, пройденные индексы
+// отмечаются в битовом массиве visited.
+static void transpose_cycles(double *a, int rows, int columns,
+                             unsigned char *visited) {
+  size_t last = (size_t)rows * columns - 1;
+  for (size_t start = 1; start < last; start++) {
+    if (visited[start >> 3] & (1u << (start & 7))) continue;
+    double value = a[start];
+    size_t i = start;
+    do {
+      size_t next = i * (size_t)rows % last;
+      double temp = a[next];
+      a[next] = value;
+      value = temp;
+      visited[next >> 3] |= (unsigned char)(1u << (next & 7));
+      i = next;
+    } while (i != start);
+  }
+}
+
+static int transpose_rectangular(matrix_t *A) {
+  int code = S21_OK;
+  int rows = A->columns;
+  int columns = A->rows;
+  size_t count = (size_t)rows * columns;
+  size_t offset = (size_t)((char *)A->matrix[0] - (char *)A->matrix);
+  int owner = s21_matrix_owner(A);
+  unsigned char *visited = calloc((count + 7) / 8, 1);
+  char *block = NULL;
+
+  if (visited == NULL) {
+    code = S21_ERROR;
+  } else if (rows > columns && owner != S21_OWNER_HEAP) {
+    code = S21_CALC_ERROR;  // Блок арены нельзя увеличить
+  } else if (rows > columns) {
+    // Новому массиву указателей нужно больше места
+    block = realloc(A->matrix, s21_matrix_block_size(rows, columns));
+    if (block == NULL) code = S21_ERROR;
+  } else {
+    block = (char *)A->matrix;
+  }
+  if (code == S21_OK) {
+    double *values = (double *)(block + offset);
+    transpose_cycles(values, columns, rows, visited);
+    memmove(s21_matrix_data(block, rows), values, count * sizeof(double));
+    s21_matrix_attach(block, rows, columns, owner, A);
+  }
+  free(visited);
+  return code;
+}
+
+int s21_transpose_inplace(matrix_t *A) {
+  int code = S21_OK;
+  if (A == NULL || A->matrix == NULL) {
+    code = S21_ERROR;
+  } else if (A->rows < 1 || A->columns < 1 ||
+             s21_matrix_owner(A) == S21_OWNER_FOREIGN) {
+    code = S21_CALC_ERROR;
+  } else if (A->rows == A->columns) {
+    transpose_square(A->matrix[0], A->rows);
+  } else {
+    code = transpose_rectangular(A);
+  }
+  return code;
+}
@@ -0,0 +1,183 @@
+#include "s21_internal.h"
+
+static int view_valid(const matrix_view_t *A) {
+  return A != NULL && A->data != NULL && A->rows >= 1 && A->columns >= 1 &&
+         A->stride >= A->columns;
+}
+
+// Окно без промежутков между строками можно обрабатывать одним массивом
+static int view_contiguous(const matrix_view_t *A) {
+  return A->stride == A->columns || A->rows == 1;
+}
+
+int s21_view_matrix(matrix_t *A, matrix_view_t *result) {
+  int code = S21_OK;
+  if (A == NULL || A->matrix == NULL || result == NULL || A->rows < 1 ||
+      A->columns < 1) {
+    code = S21_ERROR;
+  } else {
+    result->data = A->matrix[0];
+    result->rows = A->rows;
+    result->columns = A->columns;
+    result->stride = A->columns;
+  }
+  return code;
+}
+
+int s21_view_block(const matrix_view_t *A, int row, int column, int rows,
+                   int columns, matrix_view_t *result) {
+  int code = S21_OK;
+  if (!view_valid(A) || result == NULL) {
+    code = S21_ERROR;
+  } else if (row < 0 || column < 0 || rows < 1 || columns < 1 ||
+             rows > A->rows - row || columns > A->columns - column) {
+    code = S21_CALC_ERROR;
+  } else {
+    result->data = A->data + row * A->stride + column;
+    result->rows = rows;
+    result->columns = columns;
+    result->stride = A->stride;
+  }
+  return code;
+}
+
+int s21_view_copy(const matrix_view_t *A, matrix_t *result) {
+  int code = S21_OK;
+  if (!view_valid(A) || result == NULL) {
+    code = S21_ERROR;
+  } else {
+    code = s21_create_matrix(A->rows, A->columns, result);
+  }
+  if (code == S21_OK) {
+    for (int i = 0; i < A->rows; i++) {
+      memcpy(result->matrix[i], A->data + i * A->stride,
+             (size_t)A->columns * sizeof(double));
+    }
+  }
+  return code;
+}
+
+int s21_eq_view(const matrix_view_t *A, const matrix_view_t *B) {
+  int code = SUCCESS;
+  if (!view_valid(A) || !view_valid(B)) {
+    code = FAILURE;
+  } else if (A->rows != B->rows || A->columns != B->columns) {
+    code = FAILURE;
+  } else if (view_contiguous(A) && view_contiguous(B)) {
+    code = s21_vec_eq(A->data, B->data, (size_t)A->rows * A->columns, EPSILON);
+  } else {
+    for (int i = 0; i < A->rows && code == SUCCESS; i++) {
+      code = s21_vec_eq(A->data + i * A->stride, B->data + i * B->stride,
+                        (size_t)A->columns, EPSILON);
+    }
+  }
+  return code;
+}
+
+// Сумма и разность: построчно, а для окон без промежутков - одним вызовом
+// векторного ядра
+static int elementwise_view(const matrix_view_t *A, const matrix_view_t *B,
+                            matrix_t *result,
+                            void (*kernel)(const double *, const double *,
+                                           double *, size_t)) {
+  int code = S21_OK;
+  if (!view_valid(A) || !view_valid(B) || result == NULL) {
+    code = S21_ERROR;
+  } else if (A->rows != B->rows || A->columns != B->columns) {
+    code = S21_CALC_ERROR;
+  } else {
+    code = s21_create_matrix(A->rows, A->columns, result);
+  }
+  if (code == S21_OK && view_contiguous(A) && view_contiguous(B)) {
+    kernel(A->data, B->data, result->matrix[0], (size_t)A->rows * A->columns);
+  } else if (code == S21_OK) {
+    for (int i = 0; i < A->rows; i++) {
+      kernel(A->data + i * A->stride, B->data + i * B->stride,
+             result->matrix[i], (size_t)A->columns);
+    }
+  }
+  return code;
+}
+
+int s21_sum_view(const matrix_view_t *A, const matrix_view_t *B,
+                 matrix_t *result) {
+  return elementwise_view(A, B, result, s21_vec_add);
+}
+
+int s21_sub_view(const matrix_view_t *A, const matrix_view_t *B,
+                 matrix_t *result) {
+  return elementwise_view(A, B, result, s21_vec_sub);
+}
+
+int s21_mult_number_view(const matrix_view_t *A, double number,
+                         matrix_t *result) {
+  int code = S21_OK;
+  if (!view_valid(A) || result == NULL) {
+    code = S21_ERROR;
+  } else {
+    code = s21_create_matrix(A->rows, A->columns, result);
+  }
+  if (code == S21_OK && view_contiguous(A)) {
+    s21_vec_scale(A->data, number, result->matrix[0],
+                  (size_t)A->rows * A->columns);
+  } else if (code == S21_OK) {
+    for (int i = 0; i < A->rows; i++) {
+      s21_vec_scale(A->data + i * A->stride, number, result->matrix[i],
+                    (size_t)A->columns);
+    }
+  }
+  return code;
+}
+
+int s21_mult_view(const matrix_view_t *A, const matrix_view_t *B,
+                  matrix_t *result) {
+  int code = S21_OK;
+  if (!view_valid(A) || !view_valid(B) || result == NULL) {
+    code = S21_ERROR;
+  } else if (A->columns != B->rows) {
+    code = S21_CALC_ERROR;
+  } else {
+    code = s21_create_matrix(A->rows, B->columns, result);
+  }
+  if (code == S21_OK) {
+    // s21_dgemm работает с шагами строк, копировать окна не нужно
+    code = s21_dgemm(A->rows, B->columns, A->columns, 1.0, A->data, A->stride,
+                     1, B->data, B->stride, 1, 0.0, result->matrix[0],
+                     result->columns);
+    if (code != S21_OK) s21_remove_matrix(result);
+  }
+  return code;
+}
+
+int s21_transpose_view(const matrix_view_t *A, matrix_t *result) {
+  int code = S21_OK;
+  if (!view_valid(A) || result == NULL) {
+    code = S21_ERROR;
+  } else {
+    code = s21_create_matrix(A->columns, A->rows, result);
+  }
+  if (code == S21_OK) {
+    s21_transpose_block(A->data, A->stride, result->matrix[0],
+                        result->columns, A->rows, A->columns);
+  }
+  return code;
+}
+
+int s21_determinant_view(const matrix_view_t *A, double *result) {
+  int code = S21_OK;
+  if (!view_valid(A) || result == NULL || A->rows != A->columns) {
+    code = S21_ERROR;
+  } else if (A->rows <= S21_DETERMINANT_STACK) {
+    double ws[S21_DETERMINANT_STACK * S21_DETERMINANT_STACK];
+    *result = s21_determinant_gauss(A->data, A->stride, A->rows, ws);
+  } else {
+    double *ws = (double *)malloc(S21_DETERMINANT_WS_SIZE(A->rows));
+    if (ws == NULL) {
+      code = S21_ERROR;
+    } else {
+      *result = s21_determinant_gauss(A->data, A->stride, A->rows, ws);
+      free(ws);
+    }
+  }
+  return code;
+}
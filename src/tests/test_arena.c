@@ -0,0 +1,69 @@
+#include "test_main.h"
+
+START_TEST(s21_arena_test_1) {
+  s21_arena_t arena;
+  ck_assert_int_eq(s21_arena_init(&arena, 0), S21_OK);
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t C = {0};
+  ck_assert_int_eq(s21_arena_create_matrix(&arena, 4, 5, &A), S21_OK);
+  ck_assert_int_eq(s21_arena_create_matrix(&arena, 4, 5, &B), S21_OK);
+  ck_assert_int_eq(s21_arena_create_matrix(&arena, 4, 5, &C), S21_OK);
+  ck_assert_int_eq((uintptr_t)A.matrix[0] % S21_ALIGNMENT, 0);
+  for (int i = 0; i < 4; i++)
+    for (int j = 0; j < 5; j++) {
+      ck_assert_double_eq(A.matrix[i][j], 0);
+      A.matrix[i][j] = i;
+      B.matrix[i][j] = j;
+    }
+  // Матрицы арены годятся для обычных операций
+  ck_assert_int_eq(s21_sum_matrix_into(&A, &B, &C), S21_OK);
+  ck_assert_double_eq(C.matrix[3][4], 7);
+
+  // Освобожденный блок того же размера используется повторно
+  double **reused = B.matrix;
+  s21_arena_remove_matrix(&arena, &B);
+  ck_assert_ptr_null(B.matrix);
+  ck_assert_int_eq(s21_arena_create_matrix(&arena, 5, 4, &B), S21_OK);
+  ck_assert_ptr_eq(B.matrix, reused);
+  ck_assert_double_eq(B.matrix[4][3], 0);
+
+  s21_arena_destroy(&arena);
+}
+END_TEST
+
+START_TEST(s21_arena_test_2) {
+  // Маленькие куски: большие матрицы получают свой кусок, сброс сохраняет
+  // память для следующего запроса
+  s21_arena_t arena;
+  s21_arena_init(&arena, 256);
+  matrix_t big = {0};
+  matrix_t small = {0};
+  ck_assert_int_eq(s21_arena_create_matrix(&arena, 30, 30, &big), S21_OK);
+  ck_assert_int_eq(s21_arena_create_matrix(&arena, 2, 2, &small), S21_OK);
+  big.matrix[29][29] = 1;
+  double **first = big.matrix;
+
+  s21_arena_reset(&arena);
+  ck_assert_int_eq(s21_arena_create_matrix(&arena, 30, 30, &big), S21_OK);
+  ck_assert_ptr_eq(big.matrix, first);
+  ck_assert_double_eq(big.matrix[29][29], 0);
+
+  matrix_t bad = {0};
+  ck_assert_int_eq(s21_arena_create_matrix(&arena, 0, 3, &bad), S21_ERROR);
+  ck_assert_int_eq(s21_arena_create_matrix(NULL, 3, 3, &bad), S21_ERROR);
+  ck_assert_int_eq(s21_arena_init(NULL, 0), S21_ERROR);
+
+  s21_arena_destroy(&arena);
+  ck_assert_ptr_null(arena.chunks);
+}
+END_TEST
+
+Suite *test_arena() {
+  Suite *s = suite_create("\033[36m-=S21_MATRIX_ARENA=-\033[0m");
+  TCase *tc = tcase_create("case_arena");
+  tcase_add_test(tc, s21_arena_test_1);
+  tcase_add_test(tc, s21_arena_test_2);
+  suite_add_tcase(s, tc);
+  return s;
+}
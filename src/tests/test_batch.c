@@ -0,0 +1,139 @@
+#include "test_main.h"
+
+static void create_batch(matrix_t *batch, int count, int rows, int columns,
+                         int fill) {
+  for (int k = 0; k < count; k++) {
+    s21_create_matrix(rows, columns, &batch[k]);
+    for (int i = 0; i < rows && fill; i++)
+      for (int j = 0; j < columns; j++)
+        batch[k].matrix[i][j] = get_rand(-10, 10);
+  }
+}
+
+static void remove_batch(matrix_t *batch, int count) {
+  for (int k = 0; k < count; k++) s21_remove_matrix(&batch[k]);
+}
+
+// Пакет совпадает с поэлементными вызовами, в одном потоке и на пуле
+START_TEST(s21_batch_test_1) {
+  enum { count = 3000 };
+  static matrix_t A[count], B[count], C[count];
+  create_batch(A, count, 3, 4, 1);
+  create_batch(B, count, 4, 2, 1);
+  create_batch(C, count, 3, 2, 0);
+  int saved = s21_get_num_threads();
+  for (int threads = 1; threads <= 4; threads += 3) {
+    s21_set_num_threads(threads);
+    ck_assert_int_eq(s21_mult_matrix_batch(A, B, C, count), S21_OK);
+    for (int k = 0; k < count; k += 97) {
+      matrix_t expected = {0};
+      s21_mult_matrix(&A[k], &B[k], &expected);
+      ck_assert_int_eq(s21_eq_matrix(&expected, &C[k]), SUCCESS);
+      s21_remove_matrix(&expected);
+    }
+  }
+  s21_set_num_threads(saved);
+  remove_batch(A, count);
+  remove_batch(B, count);
+  remove_batch(C, count);
+}
+END_TEST
+
+START_TEST(s21_batch_test_2) {
+  enum { count = 2000 };
+  static matrix_t A[count], inv[count];
+  static double det[count];
+  create_batch(A, count, 4, 4, 1);
+  create_batch(inv, count, 4, 4, 0);
+  int saved = s21_get_num_threads();
+  s21_set_num_threads(4);
+  ck_assert_int_eq(s21_determinant_batch(A, det, count), S21_OK);
+  ck_assert_int_eq(s21_inverse_batch(A, inv, count), S21_OK);
+  s21_set_num_threads(saved);
+  for (int k = 0; k < count; k += 61) {
+    double expected = 0;
+    matrix_t expected_inv = {0};
+    s21_determinant(&A[k], &expected);
+    s21_inverse_matrix(&A[k], &expected_inv);
+    ck_assert_double_eq_tol(det[k], expected, 1e-9);
+    ck_assert_int_eq(s21_eq_matrix(&expected_inv, &inv[k]), SUCCESS);
+    s21_remove_matrix(&expected_inv);
+  }
+  remove_batch(A, count);
+  remove_batch(inv, count);
+}
+END_TEST
+
+// Большие матрицы: рабочая память определителя не помещается на стек
+START_TEST(s21_batch_test_3) {
+  matrix_t A[3];
+  double det[3];
+  create_batch(A, 3, 20, 20, 1);
+  ck_assert_int_eq(s21_determinant_batch(A, det, 3), S21_OK);
+  for (int k = 0; k < 3; k++) {
+    double expected = 0;
+    s21_determinant(&A[k], &expected);
+    ck_assert_double_eq_tol(det[k], expected, fabs(expected) * 1e-12);
+  }
+  remove_batch(A, 3);
+}
+END_TEST
+
+START_TEST(s21_batch_test_4) {
+  matrix_t A[3];
+  matrix_t R[3];
+  create_batch(A, 3, 3, 3, 1);
+  create_batch(R, 3, 3, 3, 0);
+  // Вырожденная матрица в середине пакета
+  for (int j = 0; j < 3; j++) A[1].matrix[2][j] = 2 * A[1].matrix[0][j];
+  ck_assert_int_eq(s21_inverse_batch(A, R, 3), S21_CALC_ERROR);
+  matrix_t expected = {0};
+  s21_inverse_matrix(&A[2], &expected);
+  ck_assert_int_eq(s21_eq_matrix(&expected, &R[2]), SUCCESS);
+  s21_remove_matrix(&expected);
+
+  // Пустой пакет, разные размеры, неверные аргументы
+  double det[3];
+  ck_assert_int_eq(s21_determinant_batch(A, det, 0), S21_OK);
+  ck_assert_int_eq(s21_inverse_batch(A, R, -1), S21_ERROR);
+  ck_assert_int_eq(s21_mult_matrix_batch(A, A, A, 3), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_inverse_batch(A, A, 3), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_mult_matrix_batch(NULL, A, R, 3), S21_ERROR);
+  s21_remove_matrix(&R[2]);
+  s21_create_matrix(2, 3, &R[2]);
+  ck_assert_int_eq(s21_mult_matrix_batch(A, A, R, 3), S21_CALC_ERROR);
+  s21_remove_matrix(&A[1]);
+  ck_assert_int_eq(s21_determinant_batch(A, det, 3), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_inverse_batch(A, R, 3), S21_ERROR);
+  remove_batch(A, 3);
+  remove_batch(R, 3);
+}
+END_TEST
+
+// Хорошо обусловленная матрица с малым определителем в пакете
+START_TEST(s21_batch_test_5) {
+  matrix_t A[2];
+  matrix_t R[2];
+  create_batch(A, 2, 4, 4, 1);
+  create_batch(R, 2, 4, 4, 0);
+  for (int i = 0; i < 4; i++)
+    for (int j = 0; j < 4; j++) A[1].matrix[i][j] = i != j ? 0 : i ? 1e-6 : 1;
+  ck_assert_int_eq(s21_inverse_batch(A, R, 2), S21_OK);
+  for (int i = 0; i < 4; i++)
+    ck_assert_double_eq_tol(R[1].matrix[i][i], i ? 1e6 : 1, 1e-6);
+  remove_batch(A, 2);
+  remove_batch(R, 2);
+}
+END_TEST
+
+Suite *test_batch() {
+  Suite *s = suite_create("\033[36m-=S21_MATRIX_BATCH=-\033[0m");
+  TCase *tc = tcase_create("case_batch");
+  tcase_add_test(tc, s21_batch_test_1);
+  tcase_add_test(tc, s21_batch_test_2);
+  tcase_add_test(tc, s21_batch_test_3);
+  tcase_add_test(tc, s21_batch_test_4);
+  tcase_add_test(tc, s21_batch_test_5);
+  suite_add_tcase(s, tc);
+  return s;
+}
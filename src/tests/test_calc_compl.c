@@ -101,6 +101,112 @@ START_TEST(s21_calc_compl_test_4) {
 }
 END_TEST
 
+// Дополнения по определению: определитель каждого минора
+static void brute_complements(matrix_t *A, matrix_t *C) {
+  int n = A->rows;
+  matrix_t minor = {0};
+  s21_create_matrix(n, n, C);
+  s21_create_matrix(n - 1, n - 1, &minor);
+  for (int i = 0; i < n; i++)
+    for (int j = 0; j < n; j++) {
+      for (int k = 0, r = 0; k < n; k++) {
+        if (k == i) continue;
+        for (int l = 0, c = 0; l < n; l++) {
+          if (l == j) continue;
+          minor.matrix[r][c++] = A->matrix[k][l];
+        }
+        r++;
+      }
+      double det = 0;
+      s21_determinant(&minor, &det);
+      C->matrix[i][j] = (i + j) % 2 ? -det : det;
+    }
+  s21_remove_matrix(&minor);
+}
+
+START_TEST(s21_calc_compl_test_5) {
+  // Вырожденная матрица ранга n-1: дополнения ненулевые
+  const int size = 5;
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t C = {0};
+  s21_create_matrix(size, size, &A);
+  for (int i = 0; i < size - 1; i++)
+    for (int j = 0; j < size; j++) A.matrix[i][j] = get_rand(-3, 3);
+  for (int j = 0; j < size; j++)
+    A.matrix[size - 1][j] = A.matrix[0][j] - 2 * A.matrix[2][j];
+
+  ck_assert_int_eq(s21_calc_complements(&A, &B), S21_OK);
+  brute_complements(&A, &C);
+  ck_assert_int_eq(s21_eq_matrix(&B, &C), SUCCESS);
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+  s21_remove_matrix(&C);
+}
+END_TEST
+
+START_TEST(s21_calc_compl_test_6) {
+  // Ранг 1: все дополнения нулевые
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t Z = {0};
+  s21_create_matrix(4, 4, &A);
+  s21_create_matrix(4, 4, &Z);
+  for (int i = 0; i < 4; i++)
+    for (int j = 0; j < 4; j++) A.matrix[i][j] = (i + 1) * (j + 2);
+  ck_assert_int_eq(s21_calc_complements(&A, &B), S21_OK);
+  ck_assert_int_eq(s21_eq_matrix(&B, &Z), SUCCESS);
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+  s21_remove_matrix(&Z);
+}
+END_TEST
+
+START_TEST(s21_calc_compl_test_7) {
+  const int size = 7;
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t C = {0};
+  s21_create_matrix(size, size, &A);
+  for (int i = 0; i < size; i++)
+    for (int j = 0; j < size; j++) A.matrix[i][j] = get_rand(-2, 2);
+  ck_assert_int_eq(s21_calc_complements(&A, &B), S21_OK);
+  brute_complements(&A, &C);
+  ck_assert_int_eq(s21_eq_matrix(&B, &C), SUCCESS);
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+  s21_remove_matrix(&C);
+
+  s21_create_matrix(2, 3, &A);
+  ck_assert_int_eq(s21_calc_complements(&A, &B), S21_CALC_ERROR);
+  s21_remove_matrix(&A);
+}
+END_TEST
+
+START_TEST(s21_calc_compl_test_8) {
+  // Явные формулы 2 × 2 - 4 × 4: общий случай и ранг n-1
+  for (int n = 2; n <= 4; n++) {
+    for (int singular = 0; singular <= 1; singular++) {
+      matrix_t A = {0};
+      matrix_t B = {0};
+      matrix_t C = {0};
+      s21_create_matrix(n, n, &A);
+      for (int i = 0; i < n; i++)
+        for (int j = 0; j < n; j++) A.matrix[i][j] = get_rand(-3, 3);
+      for (int j = 0; j < n && singular; j++)
+        A.matrix[n - 1][j] = 2 * A.matrix[0][j];
+      ck_assert_int_eq(s21_calc_complements(&A, &B), S21_OK);
+      brute_complements(&A, &C);
+      ck_assert_int_eq(s21_eq_matrix(&B, &C), SUCCESS);
+      s21_remove_matrix(&A);
+      s21_remove_matrix(&B);
+      s21_remove_matrix(&C);
+    }
+  }
+}
+END_TEST
+
 Suite *test_calc_compl() {
   Suite *s = suite_create("\033[36m-=S21_MATRIX_CALC_COMPL=-\033[0m");
   TCase *tc = tcase_create("case_calc_compl");
@@ -108,6 +214,10 @@ Suite *test_calc_compl() {
   tcase_add_test(tc, s21_calc_compl_test_2);
   tcase_add_test(tc, s21_calc_compl_test_3);
   tcase_add_test(tc, s21_calc_compl_test_4);
+  tcase_add_test(tc, s21_calc_compl_test_5);
+  tcase_add_test(tc, s21_calc_compl_test_6);
+  tcase_add_test(tc, s21_calc_compl_test_7);
+  tcase_add_test(tc, s21_calc_compl_test_8);
   suite_add_tcase(s, tc);
   return s;
 }
\ No newline at end of file
@@ -0,0 +1,125 @@
+#include "test_main.h"
+
+// Случайная симметричная положительно определенная матрица M × M^T + n × E
+static void fill_spd(matrix_t *A, int n) {
+  matrix_t M = {0};
+  matrix_t MT = {0};
+  s21_create_matrix(n, n, &M);
+  for (int i = 0; i < n; i++)
+    for (int j = 0; j < n; j++) M.matrix[i][j] = get_rand(-1, 1);
+  s21_transpose(&M, &MT);
+  s21_mult_matrix(&M, &MT, A);
+  for (int i = 0; i < n; i++) A->matrix[i][i] += n;
+  s21_remove_matrix(&M);
+  s21_remove_matrix(&MT);
+}
+
+// L × L^T = A на размерах из одного и нескольких блоков
+START_TEST(s21_cholesky_test_1) {
+  const int sizes[] = {1, 5, 64, 150};
+  for (int s = 0; s < 4; s++) {
+    int n = sizes[s];
+    matrix_t A = {0};
+    matrix_t L = {0};
+    matrix_t LT = {0};
+    matrix_t LLT = {0};
+    fill_spd(&A, n);
+    // Верхний треугольник не читается
+    for (int i = 0; i < n; i++)
+      for (int j = i + 1; j < n; j++) A.matrix[i][j] = NAN;
+    ck_assert_int_eq(s21_cholesky(&A, &L), S21_OK);
+    for (int i = 0; i < n; i++) {
+      ck_assert_double_eq(L.matrix[i][i] > 0, 1);
+      for (int j = i + 1; j < n; j++) ck_assert_double_eq(L.matrix[i][j], 0);
+    }
+    s21_transpose(&L, &LT);
+    s21_mult_matrix(&L, &LT, &LLT);
+    for (int i = 0; i < n; i++)
+      for (int j = 0; j <= i; j++)
+        ck_assert_double_eq_tol(LLT.matrix[i][j], A.matrix[i][j], 1e-9 * n);
+    s21_remove_matrix(&A);
+    s21_remove_matrix(&L);
+    s21_remove_matrix(&LT);
+    s21_remove_matrix(&LLT);
+  }
+
+  // Не положительно определенные матрицы
+  matrix_t A = {0};
+  matrix_t L = {0};
+  s21_create_matrix(3, 3, &A);
+  A.matrix[0][0] = 4;
+  A.matrix[1][0] = 2;
+  A.matrix[1][1] = 1;  // Вырожденная: второй ведущий элемент равен нулю
+  A.matrix[2][2] = 1;
+  ck_assert_int_eq(s21_cholesky(&A, &L), S21_CALC_ERROR);
+  ck_assert_ptr_eq(L.matrix, NULL);
+  A.matrix[1][1] = 5;
+  A.matrix[2][2] = -1;
+  ck_assert_int_eq(s21_cholesky(&A, &L), S21_CALC_ERROR);
+  s21_remove_matrix(&A);
+  s21_create_matrix(2, 3, &A);
+  ck_assert_int_eq(s21_cholesky(&A, &L), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_cholesky(NULL, &L), S21_ERROR);
+  s21_remove_matrix(&A);
+}
+END_TEST
+
+// Решение, обратная и логарифм определителя против общих функций
+START_TEST(s21_cholesky_test_2) {
+  const int sizes[][2] = {{4, 3}, {130, 20}};
+  for (int s = 0; s < 2; s++) {
+    int n = sizes[s][0];
+    int nrhs = sizes[s][1];
+    matrix_t A = {0};
+    matrix_t L = {0};
+    matrix_t B = {0};
+    matrix_t X = {0};
+    matrix_t expected = {0};
+    matrix_t inverse = {0};
+    matrix_t expected_inverse = {0};
+    fill_spd(&A, n);
+    s21_create_matrix(n, nrhs, &B);
+    for (int i = 0; i < n; i++)
+      for (int j = 0; j < nrhs; j++) B.matrix[i][j] = get_rand(-10, 10);
+    ck_assert_int_eq(s21_cholesky(&A, &L), S21_OK);
+
+    ck_assert_int_eq(s21_cholesky_solve(&L, &B, &X), S21_OK);
+    s21_solve(&A, &B, &expected);
+    ck_assert_int_eq(s21_eq_matrix(&X, &expected), SUCCESS);
+
+    ck_assert_int_eq(s21_cholesky_inverse(&L, &inverse), S21_OK);
+    s21_inverse_matrix(&A, &expected_inverse);
+    ck_assert_int_eq(s21_eq_matrix(&inverse, &expected_inverse), SUCCESS);
+
+    double logdet = 0;
+    double det = 0;
+    ck_assert_int_eq(s21_cholesky_logdet(&L, &logdet), S21_OK);
+    s21_lu_t lu = {0};
+    s21_lu_factor(&A, &lu);
+    for (int i = 0; i < n; i++) det += log(fabs(lu.lu.matrix[i][i]));
+    ck_assert_double_eq_tol(logdet, det, 1e-9 * n);
+    s21_lu_remove(&lu);
+
+    s21_remove_matrix(&B);
+    s21_create_matrix(n + 1, 1, &B);
+    ck_assert_int_eq(s21_cholesky_solve(&L, &B, &X), S21_CALC_ERROR);
+
+    s21_remove_matrix(&A);
+    s21_remove_matrix(&L);
+    s21_remove_matrix(&B);
+    s21_remove_matrix(&X);
+    s21_remove_matrix(&expected);
+    s21_remove_matrix(&inverse);
+    s21_remove_matrix(&expected_inverse);
+  }
+}
+END_TEST
+
+Suite *test_cholesky() {
+  Suite *s = suite_create("\033[36m-=S21_MATRIX_CHOLESKY=-\033[0m");
+  TCase *tc = tcase_create("case_cholesky");
+  tcase_add_test(tc, s21_cholesky_test_1);
+  tcase_add_test(tc, s21_cholesky_test_2);
+  suite_add_tcase(s, tc);
+  return s;
+}
@@ -68,6 +68,20 @@ START_TEST(s21_create_test_8) {
 }
 END_TEST
 
+START_TEST(s21_create_test_9) {
+  matrix_t A = {0};
+  int res = s21_create_matrix(7, 5, &A);
+  ck_assert_int_eq(res, S21_OK);
+  ck_assert_int_eq((uintptr_t)A.matrix[0] % S21_ALIGNMENT, 0);
+  for (int i = 0; i < A.rows; i++) {
+    ck_assert_ptr_eq(A.matrix[i], A.matrix[0] + i * A.columns);
+    for (int j = 0; j < A.columns; j++) ck_assert_double_eq(A.matrix[i][j], 0);
+  }
+  s21_remove_matrix(&A);
+  ck_assert_ptr_null(A.matrix);
+}
+END_TEST
+
 Suite *test_create() {
   Suite *s = suite_create("\033[36m-=S21_MATRIX_CREATE=-\033[0m");
   TCase *tc = tcase_create("case_create_matrix");
@@ -79,6 +93,7 @@ Suite *test_create() {
   tcase_add_test(tc, s21_create_test_6);
   tcase_add_test(tc, s21_create_test_7);
   tcase_add_test(tc, s21_create_test_8);
+  tcase_add_test(tc, s21_create_test_9);
   suite_add_tcase(s, tc);
   return s;
 }
\ No newline at end of file
@@ -79,6 +79,72 @@ START_TEST(s21_determinant_04) {
 }
 END_TEST
 
+START_TEST(s21_determinant_05) {
+  // Матрица не портится, перестановки строк не видны снаружи
+  const int size = 4;
+  matrix_t A = {0};
+  matrix_t copy = {0};
+  s21_create_matrix(size, size, &A);
+  s21_create_matrix(size, size, &copy);
+  for (int i = 0; i < size; i++)
+    for (int j = 0; j < size; j++)
+      A.matrix[i][j] = copy.matrix[i][j] = (i == size - 1 - j) ? 2 : 0;
+
+  double res = 0;
+  ck_assert_int_eq(s21_determinant(&A, &res), S21_OK);
+  ck_assert_double_eq_tol(res, 16, 1e-9);
+  ck_assert_int_eq(s21_eq_matrix(&A, &copy), SUCCESS);
+
+  double ws[size * size];
+  res = 0;
+  ck_assert_int_eq(s21_determinant_ws(&A, &res, ws), S21_OK);
+  ck_assert_double_eq_tol(res, 16, 1e-9);
+  ck_assert_int_eq(s21_eq_matrix(&A, &copy), SUCCESS);
+  ck_assert_int_eq(s21_determinant_ws(&A, &res, NULL), S21_ERROR);
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&copy);
+}
+END_TEST
+
+START_TEST(s21_determinant_06) {
+  // Больше стекового буфера: диагональная матрица с перемешанными строками
+  const int size = 40;
+  matrix_t A = {0};
+  s21_create_matrix(size, size, &A);
+  for (int i = 0; i < size; i++) A.matrix[i][(i * 7) % size] = 1.5;
+  double res = 0;
+  ck_assert_int_eq(s21_determinant(&A, &res), S21_OK);
+  ck_assert_double_eq_tol(fabs(res), pow(1.5, size), 1e-3);
+  ck_assert_double_eq(A.matrix[1][7], 1.5);
+  s21_remove_matrix(&A);
+}
+END_TEST
+
+START_TEST(s21_determinant_07) {
+  // Явные формулы 2 × 2 - 4 × 4 против LU-разложения
+  for (int n = 2; n <= 4; n++) {
+    matrix_t A = {0};
+    s21_lu_t lu = {0};
+    s21_create_matrix(n, n, &A);
+    for (int i = 0; i < n; i++)
+      for (int j = 0; j < n; j++) A.matrix[i][j] = get_rand(-5, 5);
+    double res = 0;
+    double expected = 0;
+    ck_assert_int_eq(s21_determinant(&A, &res), S21_OK);
+    s21_lu_factor(&A, &lu);
+    s21_lu_det(&lu, &expected);
+    ck_assert_double_eq_tol(res, expected, 1e-9 * (1 + fabs(expected)));
+    // Строка-копия дает точный ноль
+    for (int j = 0; j < n; j++) A.matrix[n - 1][j] = A.matrix[0][j];
+    ck_assert_int_eq(s21_determinant(&A, &res), S21_OK);
+    ck_assert_double_eq_tol(res, 0, 1e-12);
+    s21_lu_remove(&lu);
+    s21_remove_matrix(&A);
+  }
+}
+END_TEST
+
 Suite *test_dtr() {
   Suite *s = suite_create("\033[36m-=S21_MATRIX_DETERMINANT=-\033[0m");
   TCase *tc = tcase_create("case_dtr");
@@ -86,6 +152,9 @@ Suite *test_dtr() {
   tcase_add_test(tc, s21_dtr_test_2);
   tcase_add_test(tc, s21_dtr_test_3);
   tcase_add_test(tc, s21_determinant_04);
+  tcase_add_test(tc, s21_determinant_05);
+  tcase_add_test(tc, s21_determinant_06);
+  tcase_add_test(tc, s21_determinant_07);
   suite_add_tcase(s, tc);
   return s;
 }
\ No newline at end of file
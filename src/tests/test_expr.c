@@ -0,0 +1,125 @@
+#include "test_main.h"
+
+// (A + B) × k - C одним проходом против цепочки операций
+START_TEST(s21_expr_test_1) {
+  const int sizes[][2] = {{3, 5}, {300, 301}};
+  int saved = s21_get_num_threads();
+  s21_set_num_threads(4);
+  for (int s = 0; s < 2; s++) {
+    matrix_t A = {0};
+    matrix_t B = {0};
+    matrix_t C = {0};
+    matrix_t AB = {0};
+    matrix_t ABk = {0};
+    matrix_t expected = {0};
+    matrix_t result = {0};
+    fill_random(&A, sizes[s][0], sizes[s][1]);
+    fill_random(&B, sizes[s][0], sizes[s][1]);
+    fill_random(&C, sizes[s][0], sizes[s][1]);
+    s21_sum_matrix(&A, &B, &AB);
+    s21_mult_number(&AB, 2.5, &ABk);
+    s21_sub_matrix(&ABk, &C, &expected);
+
+    s21_expr_graph_t g;
+    s21_expr_init(&g);
+    s21_expr_t *sum =
+        s21_expr_sum(&g, s21_expr_matrix(&g, &A), s21_expr_matrix(&g, &B));
+    s21_expr_t *e = s21_expr_sub(&g, s21_expr_mult_number(&g, sum, 2.5),
+                                 s21_expr_matrix(&g, &C));
+    ck_assert_int_eq(s21_expr_eval(e, &result), S21_OK);
+    ck_assert_int_eq(s21_eq_matrix(&result, &expected), SUCCESS);
+    s21_expr_destroy(&g);
+
+    s21_remove_matrix(&A);
+    s21_remove_matrix(&B);
+    s21_remove_matrix(&C);
+    s21_remove_matrix(&AB);
+    s21_remove_matrix(&ABk);
+    s21_remove_matrix(&expected);
+    s21_remove_matrix(&result);
+  }
+  s21_set_num_threads(saved);
+}
+END_TEST
+
+// Произведения как границы слияния и общие подвыражения
+START_TEST(s21_expr_test_2) {
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t C = {0};
+  matrix_t D = {0};
+  fill_random(&A, 6, 4);
+  fill_random(&B, 6, 4);
+  fill_random(&C, 4, 5);
+  fill_random(&D, 4, 5);
+
+  // P = (A - B) × (C + D); результат - P + 2P и P сам по себе
+  matrix_t AB = {0};
+  matrix_t CD = {0};
+  matrix_t P = {0};
+  matrix_t P2 = {0};
+  matrix_t expected = {0};
+  s21_sub_matrix(&A, &B, &AB);
+  s21_sum_matrix(&C, &D, &CD);
+  s21_mult_matrix(&AB, &CD, &P);
+  s21_mult_number(&P, 2, &P2);
+  s21_sum_matrix(&P, &P2, &expected);
+
+  s21_expr_graph_t g;
+  s21_expr_init(&g);
+  s21_expr_t *a = s21_expr_matrix(&g, &A);
+  s21_expr_t *diff = s21_expr_sub(&g, a, s21_expr_matrix(&g, &B));
+  s21_expr_t *sum =
+      s21_expr_sum(&g, s21_expr_matrix(&g, &C), s21_expr_matrix(&g, &D));
+  s21_expr_t *p = s21_expr_mult_matrix(&g, diff, sum);
+  s21_expr_t *e = s21_expr_sum(&g, p, s21_expr_mult_number(&g, p, 2));
+
+  matrix_t result = {0};
+  ck_assert_int_eq(s21_expr_eval(e, &result), S21_OK);
+  ck_assert_int_eq(s21_eq_matrix(&result, &expected), SUCCESS);
+  s21_remove_matrix(&result);
+  ck_assert_int_eq(s21_expr_eval(p, &result), S21_OK);
+  ck_assert_int_eq(s21_eq_matrix(&result, &P), SUCCESS);
+  s21_remove_matrix(&result);
+
+  // Граф считается заново после изменения исходной матрицы
+  s21_expr_t *twice = s21_expr_sum(&g, a, a);
+  A.matrix[0][0] = 7;
+  ck_assert_int_eq(s21_expr_eval(twice, &result), S21_OK);
+  ck_assert_double_eq(result.matrix[0][0], 14);
+  s21_remove_matrix(&result);
+  ck_assert_int_eq(s21_expr_eval(a, &result), S21_OK);
+  ck_assert_int_eq(s21_eq_matrix(&result, &A), SUCCESS);
+  s21_remove_matrix(&result);
+
+  // Ошибки размеров доходят до вычисления
+  s21_expr_t *bad = s21_expr_mult_matrix(&g, a, a);
+  ck_assert_int_eq(s21_expr_eval(bad, &result), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_expr_eval(s21_expr_sum(&g, bad, a), &result),
+                   S21_CALC_ERROR);
+  ck_assert_int_eq(s21_expr_eval(s21_expr_sum(&g, p, a), &result),
+                   S21_CALC_ERROR);
+  ck_assert_ptr_eq(s21_expr_matrix(&g, NULL), NULL);
+  ck_assert_int_eq(s21_expr_eval(NULL, &result), S21_ERROR);
+  s21_expr_destroy(&g);
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+  s21_remove_matrix(&C);
+  s21_remove_matrix(&D);
+  s21_remove_matrix(&AB);
+  s21_remove_matrix(&CD);
+  s21_remove_matrix(&P);
+  s21_remove_matrix(&P2);
+  s21_remove_matrix(&expected);
+}
+END_TEST
+
+Suite *test_expr() {
+  Suite *s = suite_create("\033[36m-=S21_MATRIX_EXPR=-\033[0m");
+  TCase *tc = tcase_create("case_expr");
+  tcase_add_test(tc, s21_expr_test_1);
+  tcase_add_test(tc, s21_expr_test_2);
+  suite_add_tcase(s, tc);
+  return s;
+}
@@ -0,0 +1,202 @@
+#include "test_main.h"
+
+static void fill_random_f32(matrix_f32_t *A, int rows, int columns) {
+  s21_create_matrix_f32(rows, columns, A);
+  for (int i = 0; i < rows; i++)
+    for (int j = 0; j < columns; j++) A->matrix[i][j] = get_rand(-1, 1);
+}
+
+// Наибольшее отклонение float-матрицы от double-матрицы того же размера
+static double max_error(matrix_f32_t *A, matrix_t *B) {
+  double error = 0;
+  for (int i = 0; i < B->rows; i++)
+    for (int j = 0; j < B->columns; j++)
+      error = fmax(error, fabs(A->matrix[i][j] - B->matrix[i][j]));
+  return error;
+}
+
+// Поэлементные операции, транспонирование и преобразования типов
+START_TEST(s21_f32_test_1) {
+  const int sizes[][2] = {{1, 1}, {3, 5}, {67, 45}};
+  for (int s = 0; s < 3; s++) {
+    int rows = sizes[s][0];
+    int columns = sizes[s][1];
+    matrix_f32_t A = {0};
+    matrix_f32_t B = {0};
+    matrix_f32_t sum = {0};
+    matrix_f32_t sub = {0};
+    matrix_f32_t scaled = {0};
+    matrix_f32_t transposed = {0};
+    matrix_f32_t back = {0};
+    matrix_t wide = {0};
+    fill_random_f32(&A, rows, columns);
+    fill_random_f32(&B, rows, columns);
+    ck_assert_int_eq(s21_sum_matrix_f32(&A, &B, &sum), S21_OK);
+    ck_assert_int_eq(s21_sub_matrix_f32(&A, &B, &sub), S21_OK);
+    ck_assert_int_eq(s21_mult_number_f32(&A, 3, &scaled), S21_OK);
+    ck_assert_int_eq(s21_transpose_f32(&A, &transposed), S21_OK);
+    ck_assert_int_eq(transposed.rows, columns);
+    for (int i = 0; i < rows; i++) {
+      for (int j = 0; j < columns; j++) {
+        ck_assert_float_eq(sum.matrix[i][j], A.matrix[i][j] + B.matrix[i][j]);
+        ck_assert_float_eq(sub.matrix[i][j], A.matrix[i][j] - B.matrix[i][j]);
+        ck_assert_float_eq(scaled.matrix[i][j], A.matrix[i][j] * 3);
+        ck_assert_float_eq(transposed.matrix[j][i], A.matrix[i][j]);
+      }
+    }
+    ck_assert_int_eq((uintptr_t)A.matrix[0] % S21_ALIGNMENT, 0);
+
+    ck_assert_int_eq(s21_matrix_from_f32(&A, &wide), S21_OK);
+    ck_assert_int_eq(s21_matrix_to_f32(&wide, &back), S21_OK);
+    ck_assert_int_eq(s21_eq_matrix_f32(&A, &back), SUCCESS);
+    back.matrix[rows - 1][columns - 1] += 1e-3f;
+    ck_assert_int_eq(s21_eq_matrix_f32(&A, &back), FAILURE);
+
+    s21_remove_matrix_f32(&A);
+    s21_remove_matrix_f32(&B);
+    s21_remove_matrix_f32(&sum);
+    s21_remove_matrix_f32(&sub);
+    s21_remove_matrix_f32(&scaled);
+    s21_remove_matrix_f32(&transposed);
+    s21_remove_matrix_f32(&back);
+    s21_remove_matrix(&wide);
+  }
+
+  matrix_f32_t A = {0};
+  matrix_f32_t B = {0};
+  matrix_f32_t result = {0};
+  fill_random_f32(&A, 2, 3);
+  fill_random_f32(&B, 3, 2);
+  ck_assert_int_eq(s21_sum_matrix_f32(&A, &B, &result), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_sum_matrix_f32(NULL, &B, &result), S21_ERROR);
+  ck_assert_int_eq(s21_create_matrix_f32(0, 3, &result), S21_ERROR);
+  ck_assert_ptr_eq(result.matrix, NULL);
+  s21_remove_matrix_f32(&A);
+  s21_remove_matrix_f32(&B);
+}
+END_TEST
+
+// Произведение с накоплением во float и в double против double-эталона
+START_TEST(s21_f32_test_2) {
+  const int sizes[][3] = {{4, 5, 3}, {70, 300, 90}, {130, 70, 500}};
+  int saved = s21_get_num_threads();
+  s21_set_num_threads(3);
+  for (int s = 0; s < 3; s++) {
+    int m = sizes[s][0];
+    int k = sizes[s][1];
+    int n = sizes[s][2];
+    matrix_f32_t A = {0};
+    matrix_f32_t B = {0};
+    matrix_f32_t product = {0};
+    matrix_f32_t C = {0};
+    matrix_t A_wide = {0};
+    matrix_t B_wide = {0};
+    matrix_t expected = {0};
+    fill_random_f32(&A, m, k);
+    fill_random_f32(&B, k, n);
+    s21_matrix_from_f32(&A, &A_wide);
+    s21_matrix_from_f32(&B, &B_wide);
+    s21_mult_matrix(&A_wide, &B_wide, &expected);
+
+    ck_assert_int_eq(s21_mult_matrix_f32(&A, &B, &product), S21_OK);
+    ck_assert_double_le(max_error(&product, &expected), 1e-4);
+    s21_create_matrix_f32(m, n, &C);
+    ck_assert_int_eq(s21_gemm_f32(1, &A, S21_NO_TRANS, &B, S21_NO_TRANS, 0,
+                                  &C, S21_ACCUMULATE_F64),
+                     S21_OK);
+    // Ошибка - только округление итоговой суммы до float
+    ck_assert_double_le(max_error(&C, &expected), 2e-6);
+
+    s21_remove_matrix_f32(&A);
+    s21_remove_matrix_f32(&B);
+    s21_remove_matrix_f32(&product);
+    s21_remove_matrix_f32(&C);
+    s21_remove_matrix(&A_wide);
+    s21_remove_matrix(&B_wide);
+    s21_remove_matrix(&expected);
+  }
+  s21_set_num_threads(saved);
+
+  // C = 2 × A^T × B^T + C
+  matrix_f32_t A = {0};
+  matrix_f32_t B = {0};
+  matrix_f32_t C = {0};
+  fill_random_f32(&A, 3, 2);
+  fill_random_f32(&B, 4, 3);
+  s21_create_matrix_f32(2, 4, &C);
+  for (int mode = S21_ACCUMULATE_F32; mode <= S21_ACCUMULATE_F64; mode++) {
+    for (int i = 0; i < 2; i++)
+      for (int j = 0; j < 4; j++) C.matrix[i][j] = 1;
+    ck_assert_int_eq(
+        s21_gemm_f32(2, &A, S21_TRANS, &B, S21_TRANS, 1, &C, mode), S21_OK);
+    for (int i = 0; i < 2; i++) {
+      for (int j = 0; j < 4; j++) {
+        double sum = 0;
+        for (int p = 0; p < 3; p++) sum += A.matrix[p][i] * B.matrix[j][p];
+        ck_assert_double_eq_tol(C.matrix[i][j], 2 * sum + 1, 1e-5);
+      }
+    }
+  }
+  ck_assert_int_eq(s21_gemm_f32(1, &A, S21_NO_TRANS, &B, S21_NO_TRANS, 0, &C,
+                                S21_ACCUMULATE_F32),
+                   S21_CALC_ERROR);
+  s21_remove_matrix_f32(&A);
+  s21_remove_matrix_f32(&B);
+  s21_remove_matrix_f32(&C);
+}
+END_TEST
+
+// Определитель и обратная считаются в double
+START_TEST(s21_f32_test_3) {
+  for (int n = 2; n <= 12; n += 5) {
+    matrix_f32_t A = {0};
+    matrix_f32_t inverse = {0};
+    matrix_f32_t identity = {0};
+    matrix_t wide = {0};
+    fill_random_f32(&A, n, n);
+    for (int i = 0; i < n; i++) A.matrix[i][i] += n;
+    s21_matrix_from_f32(&A, &wide);
+    double expected = 0;
+    double det = 0;
+    s21_determinant(&wide, &expected);
+    ck_assert_int_eq(s21_determinant_f32(&A, &det), S21_OK);
+    ck_assert_double_eq_tol(det, expected, fabs(expected) * 1e-12);
+
+    ck_assert_int_eq(s21_inverse_matrix_f32(&A, &inverse), S21_OK);
+    ck_assert_int_eq(s21_mult_matrix_f32(&A, &inverse, &identity), S21_OK);
+    for (int i = 0; i < n; i++)
+      for (int j = 0; j < n; j++)
+        ck_assert_float_eq_tol(identity.matrix[i][j], i == j, 1e-5);
+
+    s21_remove_matrix_f32(&A);
+    s21_remove_matrix_f32(&inverse);
+    s21_remove_matrix_f32(&identity);
+    s21_remove_matrix(&wide);
+  }
+
+  matrix_f32_t singular = {0};
+  matrix_f32_t result = {0};
+  double det = 0;
+  s21_create_matrix_f32(3, 3, &singular);
+  ck_assert_int_eq(s21_inverse_matrix_f32(&singular, &result),
+                   S21_CALC_ERROR);
+  ck_assert_int_eq(s21_determinant_f32(&singular, &det), S21_OK);
+  ck_assert_double_eq(det, 0);
+  s21_remove_matrix_f32(&singular);
+  s21_create_matrix_f32(2, 3, &singular);
+  ck_assert_int_eq(s21_inverse_matrix_f32(&singular, &result),
+                   S21_CALC_ERROR);
+  ck_assert_int_eq(s21_determinant_f32(&singular, &det), S21_ERROR);
+  s21_remove_matrix_f32(&singular);
+}
+END_TEST
+
+Suite *test_f32() {
+  Suite *s = suite_create("\033[36m-=S21_MATRIX_F32=-\033[0m");
+  TCase *tc = tcase_create("case_f32");
+  tcase_add_test(tc, s21_f32_test_1);
+  tcase_add_test(tc, s21_f32_test_2);
+  tcase_add_test(tc, s21_f32_test_3);
+  suite_add_tcase(s, tc);
+  return s;
+}
@@ -199,6 +199,87 @@ START_TEST(s21_inverse_matrix_test_8) {
 }
 END_TEST
 
+START_TEST(s21_inverse_matrix_test_9) {
+  matrix_t A = {0};
+  matrix_t D = {0};
+  s21_create_matrix(1, 1, &A);
+  A.matrix[0][0] = 4;
+  ck_assert_int_eq(s21_inverse_matrix(&A, &D), S21_OK);
+  ck_assert_double_eq_tol(D.matrix[0][0], 0.25, 1e-12);
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&D);
+}
+END_TEST
+
+START_TEST(s21_inverse_matrix_test_10) {
+  const int size = 200;
+  matrix_t A = {0};
+  matrix_t D = {0};
+  matrix_t P = {0};
+  matrix_t E = {0};
+  s21_create_matrix(size, size, &A);
+  s21_create_matrix(size, size, &E);
+  for (int i = 0; i < size; i++) {
+    E.matrix[i][i] = 1;
+    for (int j = 0; j < size; j++) A.matrix[i][j] = get_rand(-1, 1);
+  }
+  ck_assert_int_eq(s21_inverse_matrix(&A, &D), S21_OK);
+  s21_mult_matrix(&A, &D, &P);
+  ck_assert_int_eq(s21_eq_matrix(&P, &E), SUCCESS);
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&D);
+  s21_remove_matrix(&P);
+  s21_remove_matrix(&E);
+}
+END_TEST
+
+START_TEST(s21_inverse_matrix_test_11) {
+  // Обратная через присоединенную для 2 × 2 - 4 × 4 против LU-разложения
+  for (int n = 2; n <= 4; n++) {
+    matrix_t A = {0};
+    matrix_t D = {0};
+    matrix_t expected = {0};
+    s21_lu_t lu = {0};
+    s21_create_matrix(n, n, &A);
+    for (int i = 0; i < n; i++)
+      for (int j = 0; j < n; j++) A.matrix[i][j] = get_rand(-5, 5) + (i == j);
+    ck_assert_int_eq(s21_inverse_matrix(&A, &D), S21_OK);
+    s21_lu_factor(&A, &lu);
+    s21_lu_inverse(&lu, &expected);
+    ck_assert_int_eq(s21_eq_matrix(&D, &expected), SUCCESS);
+    s21_remove_matrix(&D);
+    s21_remove_matrix(&expected);
+    s21_lu_remove(&lu);
+
+    // Вырожденная: последняя строка - сумма первых двух (для 2 × 2 - копия)
+    for (int j = 0; j < n; j++)
+      A.matrix[n - 1][j] = A.matrix[0][j] + (n > 2 ? A.matrix[1][j] : 0);
+    ck_assert_int_eq(s21_inverse_matrix(&A, &D), S21_CALC_ERROR);
+    s21_remove_matrix(&A);
+  }
+}
+END_TEST
+
+// Малый определитель при хорошей обусловленности: det = 1e-18 меньше
+// порога явных формул, но матрица обращается
+START_TEST(s21_inverse_matrix_test_12) {
+  for (int n = 2; n <= 4; n++) {
+    matrix_t A = {0};
+    matrix_t D = {0};
+    s21_create_matrix(n, n, &A);
+    A.matrix[0][0] = 1;
+    for (int i = 1; i < n; i++) A.matrix[i][i] = 1e-6;
+    ck_assert_int_eq(s21_inverse_matrix(&A, &D), S21_OK);
+    for (int i = 0; i < n; i++)
+      for (int j = 0; j < n; j++)
+        ck_assert_double_eq_tol(D.matrix[i][j], i != j ? 0 : i ? 1e6 : 1,
+                                1e-6);
+    s21_remove_matrix(&A);
+    s21_remove_matrix(&D);
+  }
+}
+END_TEST
+
 Suite *test_invert_matrix() {
   Suite *s = suite_create("\033[36m-=S21_MATRIX_INVERSE=-\033[0m");
   TCase *tc = tcase_create("case_inverse_matrix");
@@ -209,6 +290,10 @@ Suite *test_invert_matrix() {
   tcase_add_test(tc, s21_inverse_matrix_test_5);
   tcase_add_test(tc, s21_inverse_matrix_test_7);
   tcase_add_test(tc, s21_inverse_matrix_test_8);
+  tcase_add_test(tc, s21_inverse_matrix_test_9);
+  tcase_add_test(tc, s21_inverse_matrix_test_10);
+  tcase_add_test(tc, s21_inverse_matrix_test_11);
+  tcase_add_test(tc, s21_inverse_matrix_test_12);
   suite_add_tcase(s, tc);
   return s;
 }
\ No newline at end of file
@@ -0,0 +1,141 @@
+#include <stdint.h>
+
+#include "test_main.h"
+
+// Запись, чтение и отображение файла для double и float
+START_TEST(s21_io_test_1) {
+  const int sizes[][2] = {{1, 1}, {3, 5}, {300, 70}};
+  char path[] = "/tmp/s21_io_XXXXXX";
+  close(mkstemp(path));
+  for (int s = 0; s < 3; s++) {
+    int rows = sizes[s][0];
+    int columns = sizes[s][1];
+    matrix_t A = {0};
+    matrix_t loaded = {0};
+    matrix_t mapped = {0};
+    s21_create_matrix(rows, columns, &A);
+    for (int i = 0; i < rows; i++)
+      for (int j = 0; j < columns; j++) A.matrix[i][j] = get_rand(-1e6, 1e6);
+    ck_assert_int_eq(s21_save_matrix(path, &A), S21_OK);
+    ck_assert_int_eq(s21_load_matrix(path, &loaded), S21_OK);
+    ck_assert_int_eq(s21_map_matrix(path, &mapped), S21_OK);
+    ck_assert_int_eq(mapped.rows, rows);
+    ck_assert_int_eq(mapped.columns, columns);
+    ck_assert_int_eq((uintptr_t)mapped.matrix[0] % S21_ALIGNMENT, 0);
+    for (int i = 0; i < rows; i++)
+      for (int j = 0; j < columns; j++) {
+        ck_assert_double_eq(loaded.matrix[i][j], A.matrix[i][j]);
+        ck_assert_double_eq(mapped.matrix[i][j], A.matrix[i][j]);
+      }
+    s21_unmap_matrix(&mapped);
+    ck_assert_ptr_null(mapped.matrix);
+
+    matrix_f32_t F = {0};
+    matrix_f32_t F_loaded = {0};
+    matrix_f32_t F_mapped = {0};
+    s21_matrix_to_f32(&A, &F);
+    ck_assert_int_eq(s21_save_matrix_f32(path, &F), S21_OK);
+    ck_assert_int_eq(s21_load_matrix_f32(path, &F_loaded), S21_OK);
+    ck_assert_int_eq(s21_map_matrix_f32(path, &F_mapped), S21_OK);
+    ck_assert_int_eq(s21_eq_matrix_f32(&F_loaded, &F), SUCCESS);
+    ck_assert_int_eq(s21_eq_matrix_f32(&F_mapped, &F), SUCCESS);
+    s21_unmap_matrix_f32(&F_mapped);
+
+    s21_remove_matrix(&A);
+    s21_remove_matrix(&loaded);
+    s21_remove_matrix_f32(&F);
+    s21_remove_matrix_f32(&F_loaded);
+  }
+  unlink(path);
+}
+END_TEST
+
+// Файлы не того типа, усеченные и испорченные
+START_TEST(s21_io_test_2) {
+  char path[] = "/tmp/s21_io_XXXXXX";
+  close(mkstemp(path));
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_f32_t F = {0};
+  s21_create_matrix(4, 4, &A);
+  ck_assert_int_eq(s21_save_matrix(path, &A), S21_OK);
+  ck_assert_int_eq(s21_map_matrix_f32(path, &F), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_load_matrix_f32(path, &F), S21_CALC_ERROR);
+
+  // Данные короче, чем указано в заголовке
+  ck_assert_int_eq(truncate(path, S21_FILE_HEADER_SIZE + 15 * sizeof(double)),
+                   0);
+  ck_assert_int_eq(s21_map_matrix(path, &B), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_load_matrix(path, &B), S21_CALC_ERROR);
+  ck_assert_ptr_null(B.matrix);
+
+  // Не тот формат
+  FILE *file = fopen(path, "w");
+  fputs("1 2 3\n4 5 6\n", file);
+  fclose(file);
+  ck_assert_int_eq(s21_map_matrix(path, &B), S21_CALC_ERROR);
+  unlink(path);
+  ck_assert_int_eq(s21_load_matrix(path, &B), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_save_matrix(path, NULL), S21_ERROR);
+  ck_assert_int_eq(s21_save_matrix("/nonexistent/dir/file", &A),
+                   S21_CALC_ERROR);
+  ck_assert_int_eq(s21_map_matrix(NULL, &B), S21_ERROR);
+  s21_remove_matrix(&A);
+}
+END_TEST
+
+// Произведение файловых матриц по плиткам против s21_mult_matrix: плитки
+// 32 × 32 с неполными краевыми, и одна плитка на всю матрицу
+START_TEST(s21_io_test_3) {
+  char a_path[] = "/tmp/s21_io_XXXXXX";
+  char b_path[] = "/tmp/s21_io_XXXXXX";
+  char c_path[] = "/tmp/s21_io_XXXXXX";
+  close(mkstemp(a_path));
+  close(mkstemp(b_path));
+  close(mkstemp(c_path));
+  const size_t budgets[] = {6 * 32 * 32 * sizeof(double) + 100, 1 << 24};
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t expected = {0};
+  s21_create_matrix(150, 70, &A);
+  s21_create_matrix(70, 101, &B);
+  for (int i = 0; i < 150; i++)
+    for (int j = 0; j < 70; j++) A.matrix[i][j] = get_rand(-1, 1);
+  for (int i = 0; i < 70; i++)
+    for (int j = 0; j < 101; j++) B.matrix[i][j] = get_rand(-1, 1);
+  s21_mult_matrix(&A, &B, &expected);
+  s21_save_matrix(a_path, &A);
+  s21_save_matrix(b_path, &B);
+  for (int s = 0; s < 2; s++) {
+    matrix_t C = {0};
+    ck_assert_int_eq(s21_mult_matrix_file(a_path, b_path, c_path, budgets[s]),
+                     S21_OK);
+    ck_assert_int_eq(s21_load_matrix(c_path, &C), S21_OK);
+    ck_assert_int_eq(s21_eq_matrix(&C, &expected), SUCCESS);
+    s21_remove_matrix(&C);
+  }
+
+  ck_assert_int_eq(s21_mult_matrix_file(a_path, b_path, c_path, 1000),
+                   S21_ERROR);
+  ck_assert_int_eq(s21_mult_matrix_file(a_path, a_path, c_path, 1 << 20),
+                   S21_CALC_ERROR);
+  ck_assert_int_eq(s21_mult_matrix_file(a_path, b_path, a_path, 1 << 20),
+                   S21_CALC_ERROR);
+  unlink(a_path);
+  unlink(b_path);
+  unlink(c_path);
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+  s21_remove_matrix(&expected);
+}
+END_TEST
+
+Suite *test_io() {
+  Suite *s = suite_create("\033[36m-=S21_MATRIX_IO=-\033[0m");
+  TCase *tc = tcase_create("case_io");
+  tcase_add_test(tc, s21_io_test_1);
+  tcase_add_test(tc, s21_io_test_2);
+  tcase_add_test(tc, s21_io_test_3);
+  suite_add_tcase(s, tc);
+  return s;
+}
@@ -0,0 +1,177 @@
+#include "test_main.h"
+
+static void fill_2480(matrix_t *A) {
+  s21_create_matrix(5, 5, A);
+  A->matrix[0][1] = 6;
+  A->matrix[0][2] = -2;
+  A->matrix[0][3] = -1;
+  A->matrix[0][4] = 5;
+  A->matrix[1][3] = -9;
+  A->matrix[1][4] = -7;
+  A->matrix[2][1] = 15;
+  A->matrix[2][2] = 35;
+  A->matrix[3][1] = -1;
+  A->matrix[3][2] = -11;
+  A->matrix[3][3] = -2;
+  A->matrix[3][4] = 1;
+  A->matrix[4][0] = -2;
+  A->matrix[4][1] = -2;
+  A->matrix[4][2] = 3;
+  A->matrix[4][4] = -2;
+}
+
+START_TEST(s21_lu_test_1) {
+  matrix_t A = {0};
+  s21_lu_t lu = {0};
+  fill_2480(&A);
+  ck_assert_int_eq(s21_lu_factor(&A, &lu), S21_OK);
+  double det = 0;
+  ck_assert_int_eq(s21_lu_det(&lu, &det), S21_OK);
+  ck_assert_double_eq_tol(det, 2480, 1e-6);
+  // Исходная матрица не изменилась
+  ck_assert_double_eq(A.matrix[4][0], -2);
+  ck_assert_double_eq(A.matrix[0][0], 0);
+
+  // Одно разложение - несколько правых частей и обратная матрица
+  matrix_t B = {0};
+  matrix_t X = {0};
+  matrix_t AX = {0};
+  s21_create_matrix(5, 3, &B);
+  for (int i = 0; i < 5; i++)
+    for (int j = 0; j < 3; j++) B.matrix[i][j] = get_rand(-10, 10);
+  ck_assert_int_eq(s21_lu_solve(&lu, &B, &X), S21_OK);
+  s21_mult_matrix(&A, &X, &AX);
+  ck_assert_int_eq(s21_eq_matrix(&AX, &B), SUCCESS);
+
+  matrix_t inv = {0};
+  matrix_t expected = {0};
+  ck_assert_int_eq(s21_lu_inverse(&lu, &inv), S21_OK);
+  s21_inverse_matrix(&A, &expected);
+  ck_assert_int_eq(s21_eq_matrix(&inv, &expected), SUCCESS);
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+  s21_remove_matrix(&X);
+  s21_remove_matrix(&AX);
+  s21_remove_matrix(&inv);
+  s21_remove_matrix(&expected);
+  s21_lu_remove(&lu);
+}
+END_TEST
+
+START_TEST(s21_lu_test_2) {
+  // Больше ширины панели: проверяется блочное обновление
+  const int size = 150;
+  matrix_t A = {0};
+  s21_lu_t lu = {0};
+  s21_create_matrix(size, size, &A);
+  for (int i = 0; i < size; i++)
+    for (int j = 0; j < size; j++) A.matrix[i][j] = get_rand(-1, 1);
+  ck_assert_int_eq(s21_lu_factor(&A, &lu), S21_OK);
+
+  matrix_t inv = {0};
+  matrix_t product = {0};
+  matrix_t identity = {0};
+  ck_assert_int_eq(s21_lu_inverse(&lu, &inv), S21_OK);
+  s21_mult_matrix(&A, &inv, &product);
+  s21_create_matrix(size, size, &identity);
+  for (int i = 0; i < size; i++) identity.matrix[i][i] = 1;
+  ck_assert_int_eq(s21_eq_matrix(&product, &identity), SUCCESS);
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&inv);
+  s21_remove_matrix(&product);
+  s21_remove_matrix(&identity);
+  s21_lu_remove(&lu);
+}
+END_TEST
+
+START_TEST(s21_lu_test_3) {
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t X = {0};
+  s21_lu_t lu = {0};
+  s21_create_matrix(3, 3, &A);
+  s21_create_matrix(3, 1, &B);
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++) A.matrix[i][j] = i * 3 + j + 1;
+  ck_assert_int_eq(s21_lu_factor(&A, &lu), S21_OK);
+  ck_assert_int_eq(lu.singular, 1);
+  double det = 1;
+  s21_lu_det(&lu, &det);
+  ck_assert_double_eq_tol(det, 0, 1e-9);
+  ck_assert_int_eq(s21_lu_solve(&lu, &B, &X), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_lu_inverse(&lu, &X), S21_CALC_ERROR);
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+  s21_lu_remove(&lu);
+}
+END_TEST
+
+START_TEST(s21_lu_test_4) {
+  matrix_t A = {0};
+  s21_lu_t lu = {0};
+  ck_assert_int_eq(s21_lu_factor(&A, &lu), S21_ERROR);
+  s21_create_matrix(2, 3, &A);
+  ck_assert_int_eq(s21_lu_factor(&A, &lu), S21_CALC_ERROR);
+  s21_remove_matrix(&A);
+  s21_lu_remove(&lu);
+}
+END_TEST
+
+// s21_solve: несколько блоков подстановки и много правых частей
+START_TEST(s21_lu_test_5) {
+  const int sizes[][2] = {{1, 1}, {5, 2}, {150, 37}};
+  for (int s = 0; s < 3; s++) {
+    int n = sizes[s][0];
+    int nrhs = sizes[s][1];
+    matrix_t A = {0};
+    matrix_t B = {0};
+    matrix_t X = {0};
+    matrix_t AX = {0};
+    s21_create_matrix(n, n, &A);
+    s21_create_matrix(n, nrhs, &B);
+    for (int i = 0; i < n; i++) {
+      for (int j = 0; j < n; j++) A.matrix[i][j] = get_rand(-1, 1);
+      for (int j = 0; j < nrhs; j++) B.matrix[i][j] = get_rand(-10, 10);
+    }
+    ck_assert_int_eq(s21_solve(&A, &B, &X), S21_OK);
+    ck_assert_int_eq(X.rows, n);
+    ck_assert_int_eq(X.columns, nrhs);
+    s21_mult_matrix(&A, &X, &AX);
+    for (int i = 0; i < n; i++)
+      for (int j = 0; j < nrhs; j++)
+        ck_assert_double_eq_tol(AX.matrix[i][j], B.matrix[i][j], 1e-8);
+    s21_remove_matrix(&A);
+    s21_remove_matrix(&B);
+    s21_remove_matrix(&X);
+    s21_remove_matrix(&AX);
+  }
+
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t X = {0};
+  fill_2480(&A);
+  s21_create_matrix(5, 1, &B);
+  for (int j = 0; j < 5; j++) A.matrix[4][j] = 2 * A.matrix[3][j];
+  ck_assert_int_eq(s21_solve(&A, &B, &X), S21_CALC_ERROR);
+  s21_remove_matrix(&B);
+  s21_create_matrix(4, 1, &B);
+  ck_assert_int_eq(s21_solve(&A, &B, &X), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_solve(&A, NULL, &X), S21_ERROR);
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+}
+END_TEST
+
+Suite *test_lu() {
+  Suite *s = suite_create("\033[36m-=S21_MATRIX_LU=-\033[0m");
+  TCase *tc = tcase_create("case_lu");
+  tcase_add_test(tc, s21_lu_test_1);
+  tcase_add_test(tc, s21_lu_test_2);
+  tcase_add_test(tc, s21_lu_test_3);
+  tcase_add_test(tc, s21_lu_test_4);
+  tcase_add_test(tc, s21_lu_test_5);
+  suite_add_tcase(s, tc);
+  return s;
+}
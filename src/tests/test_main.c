@@ -5,6 +5,12 @@ double get_rand(double min, double max) {
   return min + val * (max - min);
 }
 
+void fill_random(matrix_t *A, int rows, int columns) {
+  s21_create_matrix(rows, columns, A);
+  for (int i = 0; i < rows; i++)
+    for (int j = 0; j < columns; j++) A->matrix[i][j] = get_rand(-1, 1);
+}
+
 int main() {
   int failed = 0;
   Suite *s21_decimal_test[] = {test_create(),
@@ -17,6 +23,18 @@ int main() {
                                test_dtr(),
                                test_calc_compl(),
                                test_invert_matrix(),
+                               test_simd(),
+                               test_lu(),
+                               test_arena(),
+                               test_batch(),
+                               test_view(),
+                               test_expr(),
+                               test_f32(),
+                               test_sparse(),
+                               test_cholesky(),
+                               test_qr(),
+                               test_io(),
+                               test_text(),
                                NULL};
 
   for (int i = 0; s21_decimal_test[i] != NULL; i++) {
@@ -20,5 +20,19 @@ Suite* test_transpose();
 Suite* test_dtr();
 Suite* test_calc_compl();
 Suite* test_invert_matrix();
+Suite* test_simd();
+Suite* test_lu();
+Suite* test_arena();
+Suite* test_batch();
+Suite* test_view();
+Suite* test_expr();
+Suite* test_f32();
+Suite* test_sparse();
+Suite* test_cholesky();
+Suite* test_qr();
+Suite* test_io();
+Suite* test_text();
 double get_rand(double min, double max);
+// Создает матрицу rows × columns со случайными элементами из [-1, 1]
+void fill_random(matrix_t* A, int rows, int columns);
 #endif  // SRC_TESTS_ME_H
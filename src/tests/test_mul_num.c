@@ -62,12 +62,28 @@ START_TEST(s21_mul_num_test_3) {
 }
 END_TEST
 
+START_TEST(s21_mul_num_test_4) {
+  matrix_t A = {0};
+  matrix_t empty = {0};
+  s21_create_matrix(3, 3, &A);
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++) A.matrix[i][j] = i * 3 + j;
+  ck_assert_int_eq(s21_mult_number_into(&A, 0.5, &A), S21_OK);
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++)
+      ck_assert_double_eq(A.matrix[i][j], (i * 3 + j) * 0.5);
+  ck_assert_int_eq(s21_mult_number_into(&A, 2, &empty), S21_ERROR);
+  s21_remove_matrix(&A);
+}
+END_TEST
+
 Suite *test_mul_num() {
   Suite *s = suite_create("\033[36m-=S21_MATRIX_MUL_NUM=-\033[0m");
   TCase *tc = tcase_create("case_mul_num_matrix");
   tcase_add_test(tc, s21_mul_num_test_1);
   tcase_add_test(tc, s21_mul_num_test_2);
   tcase_add_test(tc, s21_mul_num_test_3);
+  tcase_add_test(tc, s21_mul_num_test_4);
   suite_add_tcase(s, tc);
   return s;
 }
\ No newline at end of file
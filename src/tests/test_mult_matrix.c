@@ -114,6 +114,213 @@ START_TEST(s21_mul_matrix_test_4) {
 }
 END_TEST
 
+START_TEST(s21_mul_matrix_test_5) {
+  // Размеры не кратны блокам и пересекают границы MC и KC
+  const int rows = 130;
+  const int inner = 300;
+  const int cols = 70;
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t C = {0};
+  s21_create_matrix(rows, inner, &A);
+  s21_create_matrix(inner, cols, &B);
+  s21_create_matrix(rows, cols, &C);
+
+  for (int i = 0; i < rows; i++)
+    for (int j = 0; j < inner; j++) A.matrix[i][j] = get_rand(-2, 2);
+  for (int i = 0; i < inner; i++)
+    for (int j = 0; j < cols; j++) B.matrix[i][j] = get_rand(-2, 2);
+  for (int i = 0; i < rows; i++)
+    for (int j = 0; j < cols; j++)
+      for (int k = 0; k < inner; k++)
+        C.matrix[i][j] += A.matrix[i][k] * B.matrix[k][j];
+
+  matrix_t D = {0};
+  ck_assert_int_eq(s21_mult_matrix(&A, &B, &D), S21_OK);
+  ck_assert_int_eq(s21_eq_matrix(&C, &D), SUCCESS);
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+  s21_remove_matrix(&C);
+  s21_remove_matrix(&D);
+}
+END_TEST
+
+START_TEST(s21_mul_matrix_test_6) {
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t C = {0};
+  matrix_t D = {0};
+  s21_create_matrix(3, 2, &A);
+  s21_create_matrix(2, 4, &B);
+  s21_create_matrix(3, 4, &C);
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 2; j++) A.matrix[i][j] = get_rand(-5, 5);
+  for (int i = 0; i < 2; i++)
+    for (int j = 0; j < 4; j++) B.matrix[i][j] = get_rand(-5, 5);
+  // Повторное использование одного результата
+  for (int step = 0; step < 3; step++) {
+    C.matrix[1][1] = 100;
+    ck_assert_int_eq(s21_mult_matrix_into(&A, &B, &C), S21_OK);
+  }
+  s21_mult_matrix(&A, &B, &D);
+  ck_assert_int_eq(s21_eq_matrix(&C, &D), SUCCESS);
+  ck_assert_int_eq(s21_mult_matrix_into(&A, &B, &A), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_mult_matrix_into(&B, &A, &C), S21_CALC_ERROR);
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+  s21_remove_matrix(&C);
+  s21_remove_matrix(&D);
+}
+END_TEST
+
+START_TEST(s21_mul_matrix_test_7) {
+  // Параллельное произведение совпадает с однопоточным бит в бит
+  const int size = 260;
+  int threads = s21_get_num_threads();
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t C1 = {0};
+  matrix_t C4 = {0};
+  s21_create_matrix(size, size + 3, &A);
+  s21_create_matrix(size + 3, size - 5, &B);
+  for (int i = 0; i < A.rows; i++)
+    for (int j = 0; j < A.columns; j++) A.matrix[i][j] = get_rand(-1, 1);
+  for (int i = 0; i < B.rows; i++)
+    for (int j = 0; j < B.columns; j++) B.matrix[i][j] = get_rand(-1, 1);
+
+  ck_assert_int_eq(s21_set_num_threads(1), 1);
+  ck_assert_int_eq(s21_mult_matrix(&A, &B, &C1), S21_OK);
+  ck_assert_int_eq(s21_set_num_threads(4), 4);
+  ck_assert_int_eq(s21_get_num_threads(), 4);
+  ck_assert_int_eq(s21_mult_matrix(&A, &B, &C4), S21_OK);
+  for (int i = 0; i < C1.rows; i++)
+    for (int j = 0; j < C1.columns; j++)
+      ck_assert_double_eq(C1.matrix[i][j], C4.matrix[i][j]);
+  s21_set_num_threads(threads);
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+  s21_remove_matrix(&C1);
+  s21_remove_matrix(&C4);
+}
+END_TEST
+
+START_TEST(s21_mul_matrix_test_8) {
+  // Все сочетания транспонирования против явных транспонирования и суммы;
+  // 90 × 70 × 80 проходит упакованный блочный путь
+  const int sizes[][3] = {{3, 4, 5}, {90, 70, 80}};
+  for (int s = 0; s < 2; s++) {
+    int m = sizes[s][0];
+    int k = sizes[s][1];
+    int n = sizes[s][2];
+    for (int ta = 0; ta <= 1; ta++)
+      for (int tb = 0; tb <= 1; tb++) {
+        matrix_t A = {0};
+        matrix_t B = {0};
+        matrix_t C = {0};
+        matrix_t AT = {0};
+        matrix_t BT = {0};
+        matrix_t P = {0};
+        matrix_t P2 = {0};
+        matrix_t C3 = {0};
+        matrix_t expected = {0};
+        fill_random(&A, ta ? k : m, ta ? m : k);
+        fill_random(&B, tb ? n : k, tb ? k : n);
+        fill_random(&C, m, n);
+        if (ta) s21_transpose(&A, &AT);
+        if (tb) s21_transpose(&B, &BT);
+        s21_mult_matrix(ta ? &AT : &A, tb ? &BT : &B, &P);
+        s21_mult_number(&P, 2, &P2);
+        s21_mult_number(&C, -0.5, &C3);
+        s21_sum_matrix(&P2, &C3, &expected);
+
+        ck_assert_int_eq(s21_gemm(2, &A, ta, &B, tb, -0.5, &C), S21_OK);
+        ck_assert_int_eq(s21_eq_matrix(&C, &expected), SUCCESS);
+
+        s21_remove_matrix(&A);
+        s21_remove_matrix(&B);
+        s21_remove_matrix(&C);
+        s21_remove_matrix(&AT);
+        s21_remove_matrix(&BT);
+        s21_remove_matrix(&P);
+        s21_remove_matrix(&P2);
+        s21_remove_matrix(&C3);
+        s21_remove_matrix(&expected);
+      }
+  }
+}
+END_TEST
+
+START_TEST(s21_mul_matrix_test_9) {
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t C = {0};
+  matrix_t P = {0};
+  fill_random(&A, 4, 3);
+  fill_random(&B, 4, 3);
+  s21_create_matrix(3, 3, &C);
+  // beta == 0: мусор в C не читается
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++) C.matrix[i][j] = NAN;
+  ck_assert_int_eq(s21_gemm(1, &A, S21_TRANS, &B, S21_NO_TRANS, 0, &C),
+                   S21_OK);
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++) ck_assert(!isnan(C.matrix[i][j]));
+  // alpha == 0: только масштабирование C
+  s21_mult_number(&C, 3, &P);
+  ck_assert_int_eq(s21_gemm(0, &A, S21_TRANS, &B, S21_NO_TRANS, 3, &C),
+                   S21_OK);
+  ck_assert_int_eq(s21_eq_matrix(&C, &P), SUCCESS);
+
+  ck_assert_int_eq(s21_gemm(1, &A, S21_NO_TRANS, &B, S21_NO_TRANS, 0, &C),
+                   S21_CALC_ERROR);
+  ck_assert_int_eq(s21_gemm(1, &A, S21_NO_TRANS, &B, S21_TRANS, 0, &C),
+                   S21_CALC_ERROR);
+  ck_assert_int_eq(s21_gemm(1, &C, S21_NO_TRANS, &C, S21_NO_TRANS, 0, &C),
+                   S21_CALC_ERROR);
+  ck_assert_int_eq(s21_gemm(1, NULL, S21_NO_TRANS, &B, S21_NO_TRANS, 0, &C),
+                   S21_ERROR);
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+  s21_remove_matrix(&C);
+  s21_remove_matrix(&P);
+}
+END_TEST
+
+START_TEST(s21_mul_matrix_test_10) {
+  // Штрассен с малым порогом против классического произведения: четные,
+  // нечетные и прямоугольные размеры, несколько уровней рекурсии. В
+  // последнем случае листья умножаются с упаковкой в общем буфере.
+  const int sizes[][4] = {{64, 64, 64, 16},
+                          {101, 77, 93, 16},
+                          {130, 65, 99, 16},
+                          {301, 283, 271, 128}};
+  for (int s = 0; s < 4; s++) {
+    ck_assert_int_eq(s21_set_strassen_cutoff(sizes[s][3]), sizes[s][3]);
+    matrix_t A = {0};
+    matrix_t B = {0};
+    matrix_t classic = {0};
+    matrix_t strassen = {0};
+    fill_random(&A, sizes[s][0], sizes[s][1]);
+    fill_random(&B, sizes[s][1], sizes[s][2]);
+    s21_set_mult_algorithm(S21_MULT_CLASSIC);
+    ck_assert_int_eq(s21_mult_matrix(&A, &B, &classic), S21_OK);
+    ck_assert_int_eq(s21_set_mult_algorithm(S21_MULT_STRASSEN),
+                     S21_MULT_STRASSEN);
+    ck_assert_int_eq(s21_mult_matrix(&A, &B, &strassen), S21_OK);
+    ck_assert_int_eq(s21_eq_matrix(&strassen, &classic), SUCCESS);
+    s21_remove_matrix(&A);
+    s21_remove_matrix(&B);
+    s21_remove_matrix(&classic);
+    s21_remove_matrix(&strassen);
+  }
+  ck_assert_int_eq(s21_set_mult_algorithm(42), S21_MULT_CLASSIC);
+  ck_assert_int_eq(s21_get_mult_algorithm(), S21_MULT_CLASSIC);
+  ck_assert_int_eq(s21_set_strassen_cutoff(0), 512);
+}
+END_TEST
+
 Suite *test_mul_matrix() {
   Suite *s = suite_create("\033[36m-=S21_MATRIX_MUL_MATRIX=-\033[0m");
   TCase *tc = tcase_create("case_mul_matrix");
@@ -121,6 +328,12 @@ Suite *test_mul_matrix() {
   tcase_add_test(tc, s21_mul_matrix_test_2);
   tcase_add_test(tc, s21_mul_matrix_test_3);
   tcase_add_test(tc, s21_mul_matrix_test_4);
+  tcase_add_test(tc, s21_mul_matrix_test_5);
+  tcase_add_test(tc, s21_mul_matrix_test_6);
+  tcase_add_test(tc, s21_mul_matrix_test_7);
+  tcase_add_test(tc, s21_mul_matrix_test_8);
+  tcase_add_test(tc, s21_mul_matrix_test_9);
+  tcase_add_test(tc, s21_mul_matrix_test_10);
   suite_add_tcase(s, tc);
   return s;
 }
\ No newline at end of file
@@ -0,0 +1,112 @@
+#include "test_main.h"
+
+// Q^T × Q = E, Q × R = A, R верхнетреугольная
+START_TEST(s21_qr_test_1) {
+  const int sizes[][2] = {{1, 1}, {5, 3}, {40, 40}, {300, 70}};
+  for (int s = 0; s < 4; s++) {
+    int m = sizes[s][0];
+    int n = sizes[s][1];
+    matrix_t A = {0};
+    matrix_t Q = {0};
+    matrix_t R = {0};
+    matrix_t QT = {0};
+    matrix_t QTQ = {0};
+    matrix_t QR = {0};
+    fill_random(&A, m, n);
+    ck_assert_int_eq(s21_qr(&A, &Q, &R), S21_OK);
+    ck_assert_int_eq(Q.rows, m);
+    ck_assert_int_eq(Q.columns, n);
+    for (int i = 0; i < n; i++)
+      for (int j = 0; j < i; j++) ck_assert_double_eq(R.matrix[i][j], 0);
+    s21_transpose(&Q, &QT);
+    s21_mult_matrix(&QT, &Q, &QTQ);
+    for (int i = 0; i < n; i++)
+      for (int j = 0; j < n; j++)
+        ck_assert_double_eq_tol(QTQ.matrix[i][j], i == j, 1e-12);
+    s21_mult_matrix(&Q, &R, &QR);
+    ck_assert_int_eq(s21_eq_matrix(&QR, &A), SUCCESS);
+    s21_remove_matrix(&A);
+    s21_remove_matrix(&Q);
+    s21_remove_matrix(&R);
+    s21_remove_matrix(&QT);
+    s21_remove_matrix(&QTQ);
+    s21_remove_matrix(&QR);
+  }
+
+  matrix_t A = {0};
+  matrix_t Q = {0};
+  matrix_t R = {0};
+  fill_random(&A, 2, 3);
+  ck_assert_int_eq(s21_qr(&A, &Q, &R), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_qr(NULL, &Q, &R), S21_ERROR);
+  s21_remove_matrix(&A);
+}
+END_TEST
+
+// Наименьшие квадраты: точное решение совместной системы и невязка,
+// ортогональная столбцам A. Последний размер проходит несколькими блоками
+// строк с неполным последним.
+START_TEST(s21_qr_test_2) {
+  const int sizes[][3] = {
+      {3, 3, 1}, {200, 45, 3}, {2000, 70, 2}, {20003, 40, 1}};
+  for (int s = 0; s < 4; s++) {
+    int m = sizes[s][0];
+    int n = sizes[s][1];
+    int k = sizes[s][2];
+    matrix_t A = {0};
+    matrix_t X0 = {0};
+    matrix_t B = {0};
+    matrix_t X = {0};
+    fill_random(&A, m, n);
+    fill_random(&X0, n, k);
+    s21_mult_matrix(&A, &X0, &B);
+    ck_assert_int_eq(s21_lstsq(&A, &B, &X), S21_OK);
+    ck_assert_int_eq(s21_eq_matrix(&X, &X0), SUCCESS);
+    s21_remove_matrix(&X);
+
+    // Шум в правой части: A^T × (A × X - B) = 0
+    matrix_t AX = {0};
+    matrix_t residual = {0};
+    matrix_t normal = {0};
+    for (int i = 0; i < m; i++)
+      for (int j = 0; j < k; j++) B.matrix[i][j] += get_rand(-1, 1);
+    ck_assert_int_eq(s21_lstsq(&A, &B, &X), S21_OK);
+    s21_mult_matrix(&A, &X, &AX);
+    s21_sub_matrix(&AX, &B, &residual);
+    s21_gemm(1, &A, S21_TRANS, &residual, S21_NO_TRANS, 0, &X0);
+    s21_create_matrix(n, k, &normal);
+    ck_assert_int_eq(s21_eq_matrix(&X0, &normal), SUCCESS);
+
+    s21_remove_matrix(&A);
+    s21_remove_matrix(&X0);
+    s21_remove_matrix(&B);
+    s21_remove_matrix(&X);
+    s21_remove_matrix(&AX);
+    s21_remove_matrix(&residual);
+    s21_remove_matrix(&normal);
+  }
+
+  // Неполный ранг: третий столбец - сумма первых двух
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t X = {0};
+  fill_random(&A, 6, 3);
+  fill_random(&B, 6, 1);
+  for (int i = 0; i < 6; i++) A.matrix[i][2] = A.matrix[i][0] + A.matrix[i][1];
+  ck_assert_int_eq(s21_lstsq(&A, &B, &X), S21_CALC_ERROR);
+  s21_remove_matrix(&B);
+  fill_random(&B, 5, 1);
+  ck_assert_int_eq(s21_lstsq(&A, &B, &X), S21_CALC_ERROR);
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+}
+END_TEST
+
+Suite *test_qr() {
+  Suite *s = suite_create("\033[36m-=S21_MATRIX_QR=-\033[0m");
+  TCase *tc = tcase_create("case_qr");
+  tcase_add_test(tc, s21_qr_test_1);
+  tcase_add_test(tc, s21_qr_test_2);
+  suite_add_tcase(s, tc);
+  return s;
+}
@@ -0,0 +1,74 @@
+#include "test_main.h"
+
+// Все уровни векторных ядер должны давать одинаковый результат, включая
+// хвосты, не кратные ширине вектора
+START_TEST(s21_simd_test_1) {
+  const int rows = 7;
+  const int cols = 13;
+  int best = s21_simd_level();
+  matrix_t A = {0};
+  matrix_t B = {0};
+  s21_create_matrix(rows, cols, &A);
+  s21_create_matrix(rows, cols, &B);
+  for (int i = 0; i < rows; i++)
+    for (int j = 0; j < cols; j++) {
+      A.matrix[i][j] = get_rand(-100, 100);
+      B.matrix[i][j] = get_rand(-100, 100);
+    }
+
+  for (int level = S21_SIMD_SCALAR; level <= best; level++) {
+    ck_assert_int_eq(s21_simd_set_level(level), level);
+    matrix_t sum = {0};
+    matrix_t sub = {0};
+    matrix_t mul = {0};
+    ck_assert_int_eq(s21_sum_matrix(&A, &B, &sum), S21_OK);
+    ck_assert_int_eq(s21_sub_matrix(&A, &B, &sub), S21_OK);
+    ck_assert_int_eq(s21_mult_number(&A, -2.5, &mul), S21_OK);
+    for (int i = 0; i < rows; i++)
+      for (int j = 0; j < cols; j++) {
+        ck_assert_double_eq(sum.matrix[i][j], A.matrix[i][j] + B.matrix[i][j]);
+        ck_assert_double_eq(sub.matrix[i][j], A.matrix[i][j] - B.matrix[i][j]);
+        ck_assert_double_eq(mul.matrix[i][j], A.matrix[i][j] * -2.5);
+      }
+    ck_assert_int_eq(s21_eq_matrix(&A, &A), SUCCESS);
+    ck_assert_int_eq(s21_eq_matrix(&A, &B), FAILURE);
+    s21_remove_matrix(&sum);
+    s21_remove_matrix(&sub);
+    s21_remove_matrix(&mul);
+  }
+  ck_assert_int_eq(s21_simd_set_level(S21_SIMD_AVX512 + 1), best);
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+}
+END_TEST
+
+// Различие только в последнем элементе хвоста
+START_TEST(s21_simd_test_2) {
+  int best = s21_simd_level();
+  matrix_t A = {0};
+  matrix_t B = {0};
+  s21_create_matrix(3, 5, &A);
+  s21_create_matrix(3, 5, &B);
+  B.matrix[2][4] = 1e-6;
+  for (int level = S21_SIMD_SCALAR; level <= best; level++) {
+    s21_simd_set_level(level);
+    ck_assert_int_eq(s21_eq_matrix(&A, &B), FAILURE);
+    B.matrix[2][4] = 1e-8;
+    ck_assert_int_eq(s21_eq_matrix(&A, &B), SUCCESS);
+    B.matrix[2][4] = 1e-6;
+  }
+  s21_simd_set_level(best);
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+}
+END_TEST
+
+Suite *test_simd() {
+  Suite *s = suite_create("\033[36m-=S21_MATRIX_SIMD=-\033[0m");
+  TCase *tc = tcase_create("case_simd");
+  tcase_add_test(tc, s21_simd_test_1);
+  tcase_add_test(tc, s21_simd_test_2);
+  suite_add_tcase(s, tc);
+  return s;
+}
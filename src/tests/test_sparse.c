@@ -0,0 +1,135 @@
+#include "test_main.h"
+
+// Тройки в произвольном порядке, с повторами и явным нулем
+START_TEST(s21_sparse_test_1) {
+  const int row[] = {2, 0, 1, 2, 0, 2, 1};
+  const int column[] = {3, 1, 0, 0, 1, 3, 2};
+  const double values[] = {1, 2, 3, 4, 5, 6, 0};
+  for (int format = S21_CSR; format <= S21_CSC; format++) {
+    sparse_t A = {0};
+    sparse_t B = {0};
+    sparse_t C = {0};
+    matrix_t dense = {0};
+    matrix_t back = {0};
+    ck_assert_int_eq(
+        s21_sparse_from_triplets(3, 4, 7, row, column, values, format, &A),
+        S21_OK);
+    ck_assert_int_eq(A.nnz, 5);
+    ck_assert_int_eq(s21_sparse_to_dense(&A, &dense), S21_OK);
+    const double expected[3][4] = {{0, 7, 0, 0}, {3, 0, 0, 0}, {4, 0, 0, 7}};
+    for (int i = 0; i < 3; i++)
+      for (int j = 0; j < 4; j++)
+        ck_assert_double_eq(dense.matrix[i][j], expected[i][j]);
+    for (int o = 0; o < (format == S21_CSR ? 3 : 4); o++)
+      for (int p = A.offsets[o] + 1; p < A.offsets[o + 1]; p++)
+        ck_assert_int_gt(A.indices[p], A.indices[p - 1]);
+
+    // Смена формата и обратно, плотная матрица без нулей
+    ck_assert_int_eq(s21_sparse_convert(&A, !format, &B), S21_OK);
+    ck_assert_int_eq(s21_sparse_convert(&B, format, &C), S21_OK);
+    for (int p = 0; p < A.nnz; p++) {
+      ck_assert_int_eq(C.indices[p], A.indices[p]);
+      ck_assert_double_eq(C.values[p], A.values[p]);
+    }
+    s21_sparse_remove(&C);
+    ck_assert_int_eq(s21_sparse_from_dense(&dense, format, &C), S21_OK);
+    ck_assert_int_eq(C.nnz, 4);
+    ck_assert_int_eq(s21_sparse_to_dense(&C, &back), S21_OK);
+    ck_assert_int_eq(s21_eq_matrix(&back, &dense), SUCCESS);
+
+    s21_sparse_remove(&A);
+    s21_sparse_remove(&B);
+    s21_sparse_remove(&C);
+    s21_remove_matrix(&dense);
+    s21_remove_matrix(&back);
+  }
+
+  sparse_t A = {0};
+  const int bad_row[] = {3};
+  ck_assert_int_eq(
+      s21_sparse_from_triplets(3, 4, 1, bad_row, column, values, S21_CSR, &A),
+      S21_CALC_ERROR);
+  ck_assert_int_eq(
+      s21_sparse_from_triplets(0, 4, 0, row, column, values, S21_CSR, &A),
+      S21_ERROR);
+  ck_assert_int_eq(
+      s21_sparse_from_triplets(3, 4, 0, NULL, NULL, NULL, S21_CSC, &A),
+      S21_OK);
+  ck_assert_int_eq(A.nnz, 0);
+  s21_sparse_remove(&A);
+}
+END_TEST
+
+// Произведения на вектор и на матрицу против плотного произведения
+START_TEST(s21_sparse_test_2) {
+  const int sizes[][3] = {{7, 5, 3}, {1000, 900, 100}};
+  int saved = s21_get_num_threads();
+  s21_set_num_threads(4);
+  for (int s = 0; s < 2; s++) {
+    int rows = sizes[s][0];
+    int columns = sizes[s][1];
+    int per_row = sizes[s][2];
+    int count = rows * per_row;
+    int *row = (int *)malloc(count * sizeof(int));
+    int *column = (int *)malloc(count * sizeof(int));
+    double *values = (double *)malloc(count * sizeof(double));
+    for (int t = 0; t < count; t++) {
+      // Первые строки заполнены плотнее остальных
+      row[t] = t % 3 == 0 ? t % (rows / 4 + 1) : t % rows;
+      column[t] = rand() % columns;
+      values[t] = get_rand(-1, 1);
+    }
+    matrix_t dense = {0};
+    matrix_t B = {0};
+    matrix_t x = {0};
+    matrix_t expected = {0};
+    matrix_t expected_x = {0};
+    s21_create_matrix(columns, 3, &B);
+    s21_create_matrix(columns, 1, &x);
+    for (int i = 0; i < columns; i++) {
+      for (int j = 0; j < 3; j++) B.matrix[i][j] = get_rand(-1, 1);
+      x.matrix[i][0] = get_rand(-1, 1);
+    }
+    double *y = (double *)malloc(rows * sizeof(double));
+    for (int format = S21_CSR; format <= S21_CSC; format++) {
+      sparse_t A = {0};
+      matrix_t result = {0};
+      s21_sparse_from_triplets(rows, columns, count, row, column, values,
+                               format, &A);
+      if (format == S21_CSR) {
+        s21_sparse_to_dense(&A, &dense);
+        s21_mult_matrix(&dense, &B, &expected);
+        s21_mult_matrix(&dense, &x, &expected_x);
+      }
+      ck_assert_int_eq(s21_sparse_mult_matrix(&A, &B, &result), S21_OK);
+      ck_assert_int_eq(s21_eq_matrix(&result, &expected), SUCCESS);
+      ck_assert_int_eq(s21_sparse_mult_vector(&A, x.matrix[0], y), S21_OK);
+      for (int i = 0; i < rows; i++)
+        ck_assert_double_eq_tol(y[i], expected_x.matrix[i][0], 1e-9);
+      ck_assert_int_eq(s21_sparse_mult_matrix(&A, &dense, &result),
+                       rows == columns ? S21_OK : S21_CALC_ERROR);
+      s21_remove_matrix(&result);
+      s21_sparse_remove(&A);
+    }
+    free(row);
+    free(column);
+    free(values);
+    free(y);
+    s21_remove_matrix(&dense);
+    s21_remove_matrix(&B);
+    s21_remove_matrix(&x);
+    s21_remove_matrix(&expected);
+    s21_remove_matrix(&expected_x);
+  }
+  s21_set_num_threads(saved);
+}
+END_TEST
+
+Suite *test_sparse() {
+  Suite *s = suite_create("\033[36m-=S21_MATRIX_SPARSE=-\033[0m");
+  TCase *tc = tcase_create("case_sparse");
+  tcase_add_test(tc, s21_sparse_test_1);
+  tcase_add_test(tc, s21_sparse_test_2);
+  suite_add_tcase(s, tc);
+  return s;
+}
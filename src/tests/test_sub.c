@@ -88,6 +88,32 @@ START_TEST(s21_sub_test_4) {
 }
 END_TEST
 
+START_TEST(s21_sub_test_5) {
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t C = {0};
+  s21_create_matrix(2, 5, &A);
+  s21_create_matrix(2, 5, &B);
+  s21_create_matrix(2, 5, &C);
+  for (int i = 0; i < 2; i++)
+    for (int j = 0; j < 5; j++) {
+      A.matrix[i][j] = 10 * i + j;
+      B.matrix[i][j] = j;
+    }
+  ck_assert_int_eq(s21_sub_matrix_into(&A, &B, &C), S21_OK);
+  // На месте во второй аргумент: B = A - B
+  ck_assert_int_eq(s21_sub_matrix_into(&A, &B, &B), S21_OK);
+  for (int i = 0; i < 2; i++)
+    for (int j = 0; j < 5; j++) {
+      ck_assert_double_eq(C.matrix[i][j], 10 * i);
+      ck_assert_double_eq(B.matrix[i][j], 10 * i);
+    }
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+  s21_remove_matrix(&C);
+}
+END_TEST
+
 Suite* test_sub() {
   Suite* s = suite_create("\033[36m-=S21_MATRIX_SUB=-\033[0m");
   TCase* tc1_1 = tcase_create("case_sub_matrix");
@@ -95,6 +121,7 @@ Suite* test_sub() {
   tcase_add_test(tc1_1, s21_sub_test_2);
   tcase_add_test(tc1_1, s21_sub_test_3);
   tcase_add_test(tc1_1, s21_sub_test_4);
+  tcase_add_test(tc1_1, s21_sub_test_5);
   suite_add_tcase(s, tc1_1);
   return s;
 }
\ No newline at end of file
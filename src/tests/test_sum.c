@@ -79,12 +79,39 @@ START_TEST(s21_sum_test_3) {
 }
 END_TEST
 
+START_TEST(s21_sum_test_4) {
+  matrix_t A = {0};
+  matrix_t B = {0};
+  matrix_t wrong = {0};
+  s21_create_matrix(3, 4, &A);
+  s21_create_matrix(3, 4, &B);
+  s21_create_matrix(4, 3, &wrong);
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 4; j++) {
+      A.matrix[i][j] = i + j;
+      B.matrix[i][j] = i - j;
+    }
+  double *storage = A.matrix[0];
+  // Сумма на месте: A = A + B без выделения памяти
+  ck_assert_int_eq(s21_sum_matrix_into(&A, &B, &A), S21_OK);
+  ck_assert_ptr_eq(A.matrix[0], storage);
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 4; j++) ck_assert_double_eq(A.matrix[i][j], 2 * i);
+  ck_assert_int_eq(s21_sum_matrix_into(&A, &B, &wrong), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_sum_matrix_into(&A, &B, NULL), S21_ERROR);
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+  s21_remove_matrix(&wrong);
+}
+END_TEST
+
 Suite *test_sum() {
   Suite *s = suite_create("\033[36m-=S21_MATRIX_SUM=-\033[0m");
   TCase *tc = tcase_create("case_sum_matrix");
   tcase_add_test(tc, s21_sum_test_1);
   tcase_add_test(tc, s21_sum_test_2);
   tcase_add_test(tc, s21_sum_test_3);
+  tcase_add_test(tc, s21_sum_test_4);
   suite_add_tcase(s, tc);
   return s;
 }
\ No newline at end of file
@@ -0,0 +1,90 @@
+#include "test_main.h"
+
+// Текст во временном файле, дескриптор на его начале
+static int text_fd(const char *text) {
+  char path[] = "/tmp/s21_text_XXXXXX";
+  int fd = mkstemp(path);
+  unlink(path);
+  ck_assert_int_eq(write(fd, text, strlen(text)), (ssize_t)strlen(text));
+  lseek(fd, 0, SEEK_SET);
+  return fd;
+}
+
+// Разделители, пустые строки, \r\n и разные записи чисел
+START_TEST(s21_text_test_1) {
+  const char *text =
+      "\n1, 2.5 ,-3e2\r\n"
+      "\n"
+      "+.5\t0.000001234;1E-5\n"
+      "3.14159265358979323846264 -0 1e300\n"
+      "12345678901234567890 2.2250738585072014e-308 0.1";
+  const double expected[4][3] = {
+      {1, 2.5, -300},
+      {0.5, 0.000001234, 1e-5},
+      {3.14159265358979323846264, -0.0, 1e300},
+      {12345678901234567890.0, 2.2250738585072014e-308, 0.1}};
+  matrix_t A = {0};
+  int fd = text_fd(text);
+  ck_assert_int_eq(s21_read_matrix_fd(fd, &A), S21_OK);
+  close(fd);
+  ck_assert_int_eq(A.rows, 4);
+  ck_assert_int_eq(A.columns, 3);
+  for (int i = 0; i < 4; i++)
+    for (int j = 0; j < 3; j++)
+      ck_assert_double_eq(A.matrix[i][j], expected[i][j]);
+  ck_assert(signbit(A.matrix[2][1]));
+  s21_remove_matrix(&A);
+
+  const char *bad[] = {"1 2\n3\n", "1,,2\n", "1,2,\n", ",1\n",
+                       "1 x\n",    "1e\n",   "",       "\n \n"};
+  for (int i = 0; i < 8; i++) {
+    fd = text_fd(bad[i]);
+    ck_assert_int_eq(s21_read_matrix_fd(fd, &A), S21_CALC_ERROR);
+    ck_assert_ptr_null(A.matrix);
+    close(fd);
+  }
+  ck_assert_int_eq(s21_read_matrix_fd(-1, &A), S21_ERROR);
+}
+END_TEST
+
+// Запись и чтение без потерь; текст больше буфера чтения
+START_TEST(s21_text_test_2) {
+  const double special[] = {0.1,    -0.0,  1e22,    5e-324, 1e-300,
+                            123456, 1e16,  0.00012, -2.5e-5, 1.0 / 3};
+  const char separators[] = {' ', ',', '\t', ';'};
+  for (int s = 0; s < 4; s++) {
+    matrix_t A = {0};
+    matrix_t B = {0};
+    s21_create_matrix(300, 500, &A);
+    for (int i = 0; i < 300; i++)
+      for (int j = 0; j < 500; j++)
+        A.matrix[i][j] = j < 10 ? special[j] : get_rand(-1e3, 1e3);
+    char path[] = "/tmp/s21_text_XXXXXX";
+    int fd = mkstemp(path);
+    unlink(path);
+    ck_assert_int_eq(s21_write_matrix_fd(fd, &A, separators[s]), S21_OK);
+    lseek(fd, 0, SEEK_SET);
+    ck_assert_int_eq(s21_read_matrix_fd(fd, &B), S21_OK);
+    close(fd);
+    ck_assert_int_eq(B.rows, 300);
+    ck_assert_int_eq(B.columns, 500);
+    ck_assert_int_eq(memcmp(A.matrix[0], B.matrix[0], 300 * 500 * 8), 0);
+    s21_remove_matrix(&A);
+    s21_remove_matrix(&B);
+  }
+  matrix_t A = {0};
+  s21_create_matrix(1, 1, &A);
+  ck_assert_int_eq(s21_write_matrix_fd(1, &A, '\n'), S21_ERROR);
+  ck_assert_int_eq(s21_write_matrix_fd(1, NULL, ' '), S21_ERROR);
+  s21_remove_matrix(&A);
+}
+END_TEST
+
+Suite *test_text() {
+  Suite *s = suite_create("\033[36m-=S21_MATRIX_TEXT=-\033[0m");
+  TCase *tc = tcase_create("case_text");
+  tcase_add_test(tc, s21_text_test_1);
+  tcase_add_test(tc, s21_text_test_2);
+  suite_add_tcase(s, tc);
+  return s;
+}
@@ -69,12 +69,143 @@ START_TEST(s21_transpose_test_3) {
 }
 END_TEST
 
+START_TEST(s21_transpose_test_4) {
+  matrix_t A = {0};
+  matrix_t T = {0};
+  s21_create_matrix(2, 3, &A);
+  s21_create_matrix(3, 2, &T);
+  for (int i = 0; i < 2; i++)
+    for (int j = 0; j < 3; j++) A.matrix[i][j] = i * 3 + j;
+  ck_assert_int_eq(s21_transpose_into(&A, &T), S21_OK);
+  for (int i = 0; i < 2; i++)
+    for (int j = 0; j < 3; j++)
+      ck_assert_double_eq(T.matrix[j][i], A.matrix[i][j]);
+  ck_assert_int_eq(s21_transpose_into(&A, &A), S21_CALC_ERROR);
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&T);
+}
+END_TEST
+
+// Крупные размеры проходят рекурсию, плитки SIMD-ядер и их края
+START_TEST(s21_transpose_test_5) {
+  const int sizes[][2] = {{131, 77}, {8, 200}, {65, 64}};
+  int saved = s21_simd_level();
+  for (int level = S21_SIMD_SCALAR; level <= S21_SIMD_AVX512; level++) {
+    s21_simd_set_level(level);
+    for (int s = 0; s < 3; s++) {
+      matrix_t A = {0};
+      matrix_t T = {0};
+      s21_create_matrix(sizes[s][0], sizes[s][1], &A);
+      for (int i = 0; i < A.rows; i++)
+        for (int j = 0; j < A.columns; j++) A.matrix[i][j] = i * 1000 + j;
+      ck_assert_int_eq(s21_transpose(&A, &T), S21_OK);
+      for (int i = 0; i < A.rows; i++)
+        for (int j = 0; j < A.columns; j++)
+          ck_assert_double_eq(T.matrix[j][i], A.matrix[i][j]);
+      // То же для float: общая рекурсия с float-ядрами на листьях
+      matrix_f32_t F = {0};
+      matrix_f32_t FT = {0};
+      s21_matrix_to_f32(&A, &F);
+      ck_assert_int_eq(s21_transpose_f32(&F, &FT), S21_OK);
+      for (int i = 0; i < A.rows; i++)
+        for (int j = 0; j < A.columns; j++)
+          ck_assert_float_eq(FT.matrix[j][i], F.matrix[i][j]);
+      s21_remove_matrix(&A);
+      s21_remove_matrix(&T);
+      s21_remove_matrix_f32(&F);
+      s21_remove_matrix_f32(&FT);
+    }
+  }
+  s21_simd_set_level(saved);
+}
+END_TEST
+
+START_TEST(s21_transpose_test_6) {
+  matrix_t A = {0};
+  const int n = 75;
+  s21_create_matrix(n, n, &A);
+  for (int i = 0; i < n; i++)
+    for (int j = 0; j < n; j++) A.matrix[i][j] = i * 1000 + j;
+  ck_assert_int_eq(s21_transpose_into(&A, &A), S21_OK);
+  for (int i = 0; i < n; i++)
+    for (int j = 0; j < n; j++)
+      ck_assert_double_eq(A.matrix[i][j], j * 1000 + i);
+  ck_assert_int_eq(s21_transpose_inplace(&A), S21_OK);
+  for (int i = 0; i < n; i++)
+    for (int j = 0; j < n; j++)
+      ck_assert_double_eq(A.matrix[i][j], i * 1000 + j);
+  s21_remove_matrix(&A);
+}
+END_TEST
+
+// Прямоугольные матрицы на месте: и широкие, и высокие, и векторы
+START_TEST(s21_transpose_test_7) {
+  const int sizes[][2] = {{7, 45}, {45, 7}, {1, 9}, {9, 1}, {33, 64}};
+  for (int s = 0; s < 5; s++) {
+    matrix_t A = {0};
+    int rows = sizes[s][0];
+    int cols = sizes[s][1];
+    s21_create_matrix(rows, cols, &A);
+    for (int i = 0; i < rows; i++)
+      for (int j = 0; j < cols; j++) A.matrix[i][j] = i * 1000 + j;
+    ck_assert_int_eq(s21_transpose_inplace(&A), S21_OK);
+    ck_assert_int_eq(A.rows, cols);
+    ck_assert_int_eq(A.columns, rows);
+    for (int j = 0; j < cols; j++) {
+      ck_assert_ptr_eq(A.matrix[j], A.matrix[0] + j * rows);
+      for (int i = 0; i < rows; i++)
+        ck_assert_double_eq(A.matrix[j][i], i * 1000 + j);
+    }
+    s21_remove_matrix(&A);
+  }
+  ck_assert_int_eq(s21_transpose_inplace(NULL), S21_ERROR);
+}
+END_TEST
+
+// Матрицы, блок которых нельзя увеличить через realloc: арена и файл
+START_TEST(s21_transpose_test_8) {
+  s21_arena_t arena;
+  s21_arena_init(&arena, 0);
+  matrix_t A = {0};
+  s21_arena_create_matrix(&arena, 7, 45, &A);
+  A.matrix[1][2] = 5;
+  ck_assert_int_eq(s21_transpose_inplace(&A), S21_CALC_ERROR);
+  ck_assert_int_eq(A.rows, 7);
+  ck_assert_double_eq(A.matrix[1][2], 5);
+  s21_arena_remove_matrix(&arena, &A);
+  s21_arena_create_matrix(&arena, 45, 7, &A);
+  A.matrix[1][2] = 5;
+  ck_assert_int_eq(s21_transpose_inplace(&A), S21_OK);
+  ck_assert_int_eq(A.rows, 7);
+  ck_assert_double_eq(A.matrix[2][1], 5);
+  // Блок остается в арене: широкая матрица из него снова не транспонируется
+  ck_assert_int_eq(s21_transpose_inplace(&A), S21_CALC_ERROR);
+  s21_arena_remove_matrix(&arena, &A);
+  s21_arena_destroy(&arena);
+
+  char path[] = "/tmp/s21_transpose_XXXXXX";
+  close(mkstemp(path));
+  s21_create_matrix(3, 3, &A);
+  s21_save_matrix(path, &A);
+  s21_remove_matrix(&A);
+  ck_assert_int_eq(s21_map_matrix(path, &A), S21_OK);
+  ck_assert_int_eq(s21_transpose_inplace(&A), S21_CALC_ERROR);
+  s21_unmap_matrix(&A);
+  unlink(path);
+}
+END_TEST
+
 Suite *test_transpose() {
   Suite *s = suite_create("\033[36m-=S21_MATRIX_TRANSPOSE=-\033[0m");
   TCase *tc = tcase_create("case_transpose");
   tcase_add_test(tc, s21_transpose_test_1);
   tcase_add_test(tc, s21_transpose_test_2);
   tcase_add_test(tc, s21_transpose_test_3);
+  tcase_add_test(tc, s21_transpose_test_4);
+  tcase_add_test(tc, s21_transpose_test_5);
+  tcase_add_test(tc, s21_transpose_test_6);
+  tcase_add_test(tc, s21_transpose_test_7);
+  tcase_add_test(tc, s21_transpose_test_8);
   suite_add_tcase(s, tc);
   return s;
 }
\ No newline at end of file
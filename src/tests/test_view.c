@@ -0,0 +1,139 @@
+#include "test_main.h"
+
+static void fill_index(matrix_t *A, int rows, int columns) {
+  s21_create_matrix(rows, columns, A);
+  for (int i = 0; i < rows; i++)
+    for (int j = 0; j < columns; j++) A->matrix[i][j] = i * 100 + j;
+}
+
+START_TEST(s21_view_test_1) {
+  matrix_t A = {0};
+  matrix_view_t whole = {0};
+  matrix_view_t block = {0};
+  matrix_view_t inner = {0};
+  fill_index(&A, 6, 7);
+  ck_assert_int_eq(s21_view_matrix(&A, &whole), S21_OK);
+  ck_assert_int_eq(s21_view_block(&whole, 1, 2, 4, 3, &block), S21_OK);
+  ck_assert_int_eq(s21_view_block(&block, 1, 1, 2, 2, &inner), S21_OK);
+  ck_assert_ptr_eq(inner.data, &A.matrix[2][3]);
+  ck_assert_int_eq(inner.stride, 7);
+
+  // Окно без копирования: запись видна в исходной матрице
+  block.data[block.stride + 1] = -1;
+  ck_assert_double_eq(A.matrix[2][3], -1);
+
+  matrix_t copy = {0};
+  ck_assert_int_eq(s21_view_copy(&block, &copy), S21_OK);
+  ck_assert_int_eq(copy.rows, 4);
+  ck_assert_int_eq(copy.columns, 3);
+  for (int i = 0; i < 4; i++)
+    for (int j = 0; j < 3; j++)
+      ck_assert_double_eq(copy.matrix[i][j], A.matrix[i + 1][j + 2]);
+
+  ck_assert_int_eq(s21_view_block(&whole, 3, 0, 4, 1, &block), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_view_block(&whole, -1, 0, 1, 1, &block),
+                   S21_CALC_ERROR);
+  ck_assert_int_eq(s21_view_block(NULL, 0, 0, 1, 1, &block), S21_ERROR);
+  matrix_t empty = {0};
+  ck_assert_int_eq(s21_view_matrix(&empty, &block), S21_ERROR);
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&copy);
+}
+END_TEST
+
+// Операции над окнами совпадают с операциями над их копиями
+START_TEST(s21_view_test_2) {
+  matrix_t A = {0};
+  matrix_view_t whole = {0};
+  matrix_view_t left = {0};
+  matrix_view_t right = {0};
+  fill_index(&A, 9, 10);
+  s21_view_matrix(&A, &whole);
+  s21_view_block(&whole, 1, 0, 5, 5, &left);
+  s21_view_block(&whole, 3, 5, 5, 5, &right);
+  matrix_t L = {0};
+  matrix_t R = {0};
+  s21_view_copy(&left, &L);
+  s21_view_copy(&right, &R);
+
+  matrix_t got = {0};
+  matrix_t expected = {0};
+  ck_assert_int_eq(s21_sum_view(&left, &right, &got), S21_OK);
+  s21_sum_matrix(&L, &R, &expected);
+  ck_assert_int_eq(s21_eq_matrix(&got, &expected), SUCCESS);
+  s21_remove_matrix(&got);
+  s21_remove_matrix(&expected);
+
+  ck_assert_int_eq(s21_sub_view(&left, &right, &got), S21_OK);
+  s21_sub_matrix(&L, &R, &expected);
+  ck_assert_int_eq(s21_eq_matrix(&got, &expected), SUCCESS);
+  s21_remove_matrix(&got);
+  s21_remove_matrix(&expected);
+
+  ck_assert_int_eq(s21_mult_number_view(&left, 2.5, &got), S21_OK);
+  s21_mult_number(&L, 2.5, &expected);
+  ck_assert_int_eq(s21_eq_matrix(&got, &expected), SUCCESS);
+  s21_remove_matrix(&got);
+  s21_remove_matrix(&expected);
+
+  ck_assert_int_eq(s21_mult_view(&left, &right, &got), S21_OK);
+  s21_mult_matrix(&L, &R, &expected);
+  ck_assert_int_eq(s21_eq_matrix(&got, &expected), SUCCESS);
+  s21_remove_matrix(&got);
+  s21_remove_matrix(&expected);
+
+  ck_assert_int_eq(s21_transpose_view(&right, &got), S21_OK);
+  s21_transpose(&R, &expected);
+  ck_assert_int_eq(s21_eq_matrix(&got, &expected), SUCCESS);
+  s21_remove_matrix(&got);
+  s21_remove_matrix(&expected);
+
+  matrix_view_t copy_view = {0};
+  s21_view_matrix(&L, &copy_view);
+  ck_assert_int_eq(s21_eq_view(&left, &copy_view), SUCCESS);
+  ck_assert_int_eq(s21_eq_view(&left, &right), FAILURE);
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&L);
+  s21_remove_matrix(&R);
+}
+END_TEST
+
+START_TEST(s21_view_test_3) {
+  // Определитель окна: и явные формулы, и метод Гаусса
+  matrix_t A = {0};
+  matrix_view_t whole = {0};
+  matrix_view_t block = {0};
+  s21_create_matrix(12, 12, &A);
+  for (int i = 0; i < 12; i++)
+    for (int j = 0; j < 12; j++) A.matrix[i][j] = get_rand(-2, 2);
+  s21_view_matrix(&A, &whole);
+  for (int n = 2; n <= 8; n += 3) {
+    matrix_t copy = {0};
+    double got = 0;
+    double expected = 0;
+    s21_view_block(&whole, 2, 3, n, n, &block);
+    s21_view_copy(&block, &copy);
+    ck_assert_int_eq(s21_determinant_view(&block, &got), S21_OK);
+    s21_determinant(&copy, &expected);
+    ck_assert_double_eq_tol(got, expected, 1e-12 * (1 + fabs(expected)));
+    s21_remove_matrix(&copy);
+  }
+  s21_view_block(&whole, 0, 0, 2, 3, &block);
+  double det = 0;
+  ck_assert_int_eq(s21_determinant_view(&block, &det), S21_ERROR);
+  matrix_t out = {0};
+  ck_assert_int_eq(s21_mult_view(&block, &block, &out), S21_CALC_ERROR);
+  s21_remove_matrix(&A);
+}
+END_TEST
+
+Suite *test_view() {
+  Suite *s = suite_create("\033[36m-=S21_MATRIX_VIEW=-\033[0m");
+  TCase *tc = tcase_create("case_view");
+  tcase_add_test(tc, s21_view_test_1);
+  tcase_add_test(tc, s21_view_test_2);
+  tcase_add_test(tc, s21_view_test_3);
+  suite_add_tcase(s, tc);
+  return s;
+}